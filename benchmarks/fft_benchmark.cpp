@@ -0,0 +1,98 @@
+#include "project.h"
+#include "DSP/FFT.hpp"
+
+#include <chrono>
+#include <complex>
+#include <iomanip>
+
+using namespace audio;
+
+namespace
+{
+    using Complex = std::complex<float>;
+
+    // Reference O(N^2) transform with a precomputed root table
+    void naive_dft(const std::vector<Complex> &in, std::vector<Complex> &out)
+    {
+        const size_t n = in.size();
+        std::vector<Complex> roots(n);
+        for (size_t k = 0; k < n; ++k)
+        {
+            roots[k] = std::polar(1.0f, static_cast<float>(-dsp::TWO_PI * k / n));
+        }
+
+        for (size_t k = 0; k < n; ++k)
+        {
+            Complex sum = 0.0f;
+            for (size_t t = 0; t < n; ++t)
+            {
+                sum += in[t] * roots[(k * t) % n];
+            }
+            out[k] = sum;
+        }
+    }
+
+    // Average microseconds per call of func, repeated for ~0.2 s
+    template <typename Func>
+    double time_us(Func &&func)
+    {
+        using clock = std::chrono::steady_clock;
+        size_t iterations = 0;
+        const auto start = clock::now();
+        auto elapsed = clock::duration::zero();
+        do
+        {
+            func();
+            ++iterations;
+            elapsed = clock::now() - start;
+        } while (elapsed < std::chrono::milliseconds(200));
+
+        return std::chrono::duration<double, std::micro>(elapsed).count() / static_cast<double>(iterations);
+    }
+}
+
+int main()
+{
+    std::cout << "FFT benchmark (float, microseconds per transform)\n\n"
+              << std::setw(8) << "size"
+              << std::setw(14) << "complex"
+              << std::setw(14) << "real"
+              << std::setw(14) << "naive DFT"
+              << std::setw(12) << "speedup" << "\n";
+
+    // Powers of two (radix-4/2) and mixed-radix sizes
+    for (size_t size : {64, 256, 480, 1000, 1024, 4096, 6000, 16384, 65536})
+    {
+        auto fft = dsp::FFT<float>::plan(size);
+
+        std::vector<Complex> data(size);
+        std::vector<float> real(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            real[i] = std::sin(0.01f * static_cast<float>(i));
+            data[i] = Complex(real[i], 0.0f);
+        }
+        std::vector<Complex> bins(fft->num_bins());
+        std::vector<Complex> reference(size);
+
+        const double complex_us = time_us([&]
+                                          { fft->forward(data.data()); fft->inverse(data.data()); }) / 2.0;
+        const double real_us = time_us([&]
+                                       { fft->forward_real(real.data(), bins.data()); });
+
+        std::cout << std::setw(8) << size
+                  << std::setw(14) << std::fixed << std::setprecision(2) << complex_us
+                  << std::setw(14) << real_us;
+
+        if (size <= 6000)
+        {
+            const double naive_us = time_us([&]
+                                            { naive_dft(data, reference); });
+            std::cout << std::setw(14) << naive_us
+                      << std::setw(11) << std::setprecision(0) << naive_us / complex_us << "x";
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
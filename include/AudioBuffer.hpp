@@ -1,17 +1,166 @@
 #pragma once
 
 #include "project.h"
+#include "ChannelDispatch.hpp"
+#include "SIMD/GainKernels.hpp"
+#include "SIMD/Interleave.hpp"
 
 namespace audio
 {
+    /**
+     * @brief Non-owning strided view of one channel of an interleaved buffer
+     *
+     * Bounds are validated once when the view is created, element access is
+     * only asserted in debug builds so loops over it stay tight.
+     */
+    template <typename T>
+    class ChannelView
+    {
+    public:
+        ChannelView(T *first, size_t size, size_t stride) noexcept
+            : first_(first), size_(size), stride_(stride) {}
+
+        T &operator[](size_t index) const noexcept
+        {
+            assert(index < size_);
+            return first_[index * stride_];
+        }
+
+        size_t size() const noexcept { return size_; }
+        size_t stride() const noexcept { return stride_; }
+        T *data() const noexcept { return first_; }
+
+    private:
+        T *first_;
+        size_t size_;
+        size_t stride_;
+    };
+
+    /**
+     * @brief Random-access iterator over the frames of an interleaved buffer
+     *
+     * Dereferencing yields a std::span covering every channel of one frame;
+     * with a fixed Extent the span size is a compile-time constant.
+     */
+    template <typename T, size_t Extent = dynamic_channels>
+    class FrameIterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::span<T, Extent>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::span<T, Extent>;
+
+        FrameIterator() = default;
+
+        FrameIterator(T *frame, size_t num_channels) noexcept
+            : frame_(frame), num_channels_(num_channels) {}
+
+        reference operator*() const noexcept { return reference(frame_, resolve_channels<Extent>(num_channels_)); }
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        FrameIterator &operator++() noexcept
+        {
+            frame_ += resolve_channels<Extent>(num_channels_);
+            return *this;
+        }
+        FrameIterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        FrameIterator &operator--() noexcept
+        {
+            frame_ -= resolve_channels<Extent>(num_channels_);
+            return *this;
+        }
+        FrameIterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+        FrameIterator &operator+=(difference_type n) noexcept
+        {
+            frame_ += n * static_cast<difference_type>(resolve_channels<Extent>(num_channels_));
+            return *this;
+        }
+        FrameIterator &operator-=(difference_type n) noexcept { return *this += -n; }
+
+        friend FrameIterator operator+(FrameIterator it, difference_type n) noexcept { return it += n; }
+        friend FrameIterator operator+(difference_type n, FrameIterator it) noexcept { return it += n; }
+        friend FrameIterator operator-(FrameIterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const FrameIterator &a, const FrameIterator &b) noexcept
+        {
+            return a.num_channels_ == 0 ? 0 : (a.frame_ - b.frame_) / static_cast<difference_type>(a.num_channels_);
+        }
+
+        friend bool operator==(const FrameIterator &a, const FrameIterator &b) noexcept { return a.frame_ == b.frame_; }
+        friend auto operator<=>(const FrameIterator &a, const FrameIterator &b) noexcept { return a.frame_ <=> b.frame_; }
+
+    private:
+        T *frame_ = nullptr;
+        size_t num_channels_ = 0;
+    };
+
+    /**
+     * @brief Range of consecutive frames, validated once on creation
+     */
+    template <typename T, size_t Extent = dynamic_channels>
+    class FrameRange
+    {
+    public:
+        using iterator = FrameIterator<T, Extent>;
+
+        FrameRange(T *first, size_t num_frames, size_t num_channels) noexcept
+            : first_(first), num_frames_(num_frames), num_channels_(num_channels) {}
+
+        iterator begin() const noexcept { return {first_, num_channels_}; }
+        iterator end() const noexcept { return {first_ + num_frames_ * num_channels_, num_channels_}; }
+
+        std::span<T, Extent> operator[](size_t index) const noexcept
+        {
+            assert(index < num_frames_);
+            return std::span<T, Extent>(first_ + index * num_channels_, resolve_channels<Extent>(num_channels_));
+        }
+
+        size_t size() const noexcept { return num_frames_; }
+        size_t num_channels() const noexcept { return resolve_channels<Extent>(num_channels_); }
+
+        /**
+         * Re-view the range with a compile-time channel count, e.g. inside a
+         * dispatch_channels() kernel; the count is only asserted in debug builds
+         */
+        template <size_t NewExtent>
+        FrameRange<T, NewExtent> with_extent() const noexcept
+        {
+            assert(NewExtent == dynamic_channels || NewExtent == num_channels_);
+            return {first_, num_frames_, num_channels_};
+        }
+
+        /// All samples of the range as one contiguous interleaved span
+        std::span<T> samples() const noexcept { return {first_, num_frames_ * num_channels_}; }
+
+    private:
+        T *first_;
+        size_t num_frames_;
+        size_t num_channels_;
+    };
+
+    template <typename SampleType, size_t Channels = dynamic_channels>
+    class AudioBuffer;
+
     /**
      * @brief Generic audio buffer for storing samples
      *
      * Template allows different sample types
      * (int16_t, int32_t, float, double)
+     * This is the runtime channel count form (AudioBuffer<SampleType>)
      */
     template <typename SampleType>
-    class AudioBuffer
+    class AudioBuffer<SampleType, dynamic_channels>
     {
     private:
         std::unique_ptr<SampleType[]> buffer_;
@@ -31,6 +180,15 @@ namespace audio
                 throw std::out_of_range("Channel index out of range");
         }
 
+        /**
+         * @brief Error handling for out of bound frame blocks
+         */
+        void check_block(size_t first, size_t count) const
+        {
+            if (first > num_samples_ || count > num_samples_ - first)
+                throw std::out_of_range("Frame block out of range");
+        }
+
     public:
         /// Default constructor
         AudioBuffer() : num_samples_(0), num_channels_(0) {}
@@ -120,6 +278,113 @@ namespace audio
             return buffer_[sample_index * num_channels_ + channel];
         }
 
+        /**
+         * @brief Unchecked access at (sample_index, channel)
+         *
+         * Only asserted in debug builds; validate the range once per block
+         * (e.g. via frames()) before using this in a hot loop.
+         */
+        SampleType &at_unchecked(size_t sample_index, size_t channel) noexcept
+        {
+            assert(sample_index < num_samples_ && channel < num_channels_);
+            return buffer_[sample_index * num_channels_ + channel];
+        }
+
+        /**
+         * @brief Unchecked access at (sample_index, channel)
+         */
+        const SampleType &at_unchecked(size_t sample_index, size_t channel) const noexcept
+        {
+            assert(sample_index < num_samples_ && channel < num_channels_);
+            return buffer_[sample_index * num_channels_ + channel];
+        }
+
+        /**
+         * @brief All interleaved samples as a contiguous span
+         */
+        std::span<SampleType> samples() noexcept
+        {
+            return {buffer_.get(), total_samples()};
+        }
+
+        /**
+         * @brief All interleaved samples as a contiguous span
+         */
+        std::span<const SampleType> samples() const noexcept
+        {
+            return {buffer_.get(), total_samples()};
+        }
+
+        /**
+         * @brief Span over every channel of one frame
+         */
+        std::span<SampleType> frame(size_t sample_index)
+        {
+            check_bounds(sample_index, 0);
+            return {buffer_.get() + sample_index * num_channels_, num_channels_};
+        }
+
+        /**
+         * @brief Span over every channel of one frame
+         */
+        std::span<const SampleType> frame(size_t sample_index) const
+        {
+            check_bounds(sample_index, 0);
+            return {buffer_.get() + sample_index * num_channels_, num_channels_};
+        }
+
+        /**
+         * @brief Strided view of a single channel
+         */
+        ChannelView<SampleType> channel(size_t channel)
+        {
+            check_bounds(0, channel);
+            return {buffer_.get() + channel, num_samples_, num_channels_};
+        }
+
+        /**
+         * @brief Strided view of a single channel
+         */
+        ChannelView<const SampleType> channel(size_t channel) const
+        {
+            check_bounds(0, channel);
+            return {buffer_.get() + channel, num_samples_, num_channels_};
+        }
+
+        /**
+         * @brief Iterable range over all frames
+         */
+        FrameRange<SampleType> frames() noexcept
+        {
+            return {buffer_.get(), num_samples_, num_channels_};
+        }
+
+        /**
+         * @brief Iterable range over all frames
+         */
+        FrameRange<const SampleType> frames() const noexcept
+        {
+            return {buffer_.get(), num_samples_, num_channels_};
+        }
+
+        /**
+         * @brief Iterable range over [first, first + count), checked once
+         */
+        FrameRange<SampleType> frames(size_t first, size_t count)
+        {
+            check_block(first, count);
+            return {buffer_.get() + first * num_channels_, count, num_channels_};
+        }
+
+        /**
+         * @brief Iterable range over [first, first + count), checked once
+         */
+        FrameRange<const SampleType> frames(size_t first, size_t count) const
+        {
+            check_block(first, count);
+            return {buffer_.get() + first * num_channels_, count, num_channels_};
+        }
+
         /**
          * @brief Get raw pointer to data
          */
@@ -197,10 +462,7 @@ namespace audio
             }
 
             AudioBuffer result(num_samples_, 1);
-            for (size_t i = 0; i < num_samples_; ++i)
-            {
-                result(i, 0) = (*this)(i, channel);
-            }
+            simd::extract_channel(buffer_.get(), num_samples_, num_channels_, channel, result.data());
             return result;
         }
 
@@ -218,34 +480,247 @@ namespace audio
                 throw std::invalid_argument("Source must be mono with matching sample count");
             }
 
-            for (size_t i = 0; i < num_samples_; ++i)
-            {
-                (*this)(i, channel) = source(i, 0);
-            }
+            simd::insert_channel(source.data(), num_samples_, num_channels_, channel, buffer_.get());
         }
 
-        // Apply gain to entire buffer
+        /**
+         * @brief Copy every channel into separate planar arrays
+         * @param planar num_channels() pointers to num_samples() samples each
+         */
+        void copy_to_planar(SampleType *const *planar) const
+        {
+            simd::deinterleave(buffer_.get(), num_samples_, num_channels_, planar);
+        }
+
+        /**
+         * @brief Fill every channel from separate planar arrays
+         * @param planar num_channels() pointers to num_samples() samples each
+         */
+        void copy_from_planar(const SampleType *const *planar)
+        {
+            simd::interleave(planar, num_samples_, num_channels_, buffer_.get());
+        }
+
+        /**
+         * @brief Build a buffer whose channel c is this buffer's channel_map[c]
+         * Reorders, drops or duplicates channels in one pass
+         */
+        AudioBuffer remap_channels(std::span<const size_t> channel_map) const
+        {
+            AudioBuffer result(num_samples_, channel_map.size());
+            simd::shuffle_channels(buffer_.get(), num_samples_, num_channels_, channel_map, result.data());
+            return result;
+        }
+
+        // Apply gain to entire buffer (saturates for integer samples)
         void apply_gain(float gain)
         {
-            for (size_t i = 0; i < total_samples(); ++i)
-            {
-                buffer_[i] = static_cast<SampleType>(buffer_[i] * gain);
-            }
+            simd::apply_gain(buffer_.get(), total_samples(), gain);
+        }
+
+        // Apply a gain ramping linearly from start_gain to end_gain over the buffer
+        void apply_gain_ramp(float start_gain, float end_gain)
+        {
+            simd::apply_gain_ramp(buffer_.get(), num_samples_, num_channels_, start_gain, end_gain);
         }
 
         // Mix (add) another buffer into this one
         void mix(const AudioBuffer &other, float gain = 1.0f)
+        {
+            check_same_layout(other);
+            simd::mix(buffer_.get(), other.buffer_.get(), total_samples(), gain);
+        }
+
+        // Mix another buffer into this one with a linearly ramping gain
+        void mix_ramp(const AudioBuffer &other, float start_gain, float end_gain)
+        {
+            check_same_layout(other);
+            simd::mix_ramp(buffer_.get(), other.buffer_.get(), num_samples_, num_channels_, start_gain, end_gain);
+        }
+
+    private:
+        void check_same_layout(const AudioBuffer &other) const
         {
             if (num_samples_ != other.num_samples_ || num_channels_ != other.num_channels_)
             {
                 throw std::invalid_argument("Buffer dimensions must match for mixing");
             }
+        }
+    }; // class AudioBuffer
+
+    /**
+     * @brief Audio buffer with a compile-time channel count
+     *
+     * Built on the dynamic buffer, privately, so nothing can change its
+     * channel count behind its back; its own accessors use the constant
+     * channel count so frame loops unroll. A default-constructed or
+     * moved-from buffer has no frames but still reports Channels channels.
+     * To run an AudioEffect over it, release() the storage into a dynamic
+     * buffer and adopt it back afterwards (no copies either way):
+     *
+     *   AudioBuffer<float> work = std::move(stereo).release();
+     *   effect.process(work);
+     *   stereo = StereoBuffer<float>(std::move(work));
+     */
+    template <typename SampleType, size_t Channels>
+    class AudioBuffer : private AudioBuffer<SampleType, dynamic_channels>
+    {
+        static_assert(Channels > 0, "Channel count must be positive");
+
+        using Base = AudioBuffer<SampleType, dynamic_channels>;
+
+    public:
+        AudioBuffer() = default;
+
+        explicit AudioBuffer(size_t num_samples)
+            : Base(num_samples, Channels) {}
+
+        AudioBuffer(size_t num_samples, size_t num_channels)
+            : Base(num_samples, checked_channels(num_channels)) {}
+
+        /// Adopt the storage of a dynamic buffer with a matching channel count
+        explicit AudioBuffer(Base &&other)
+            : Base(checked_adopt(std::move(other))) {}
+
+        /// Hand the storage over to a dynamic buffer (this one is left empty)
+        Base release() &&
+        {
+            return Base(std::move(static_cast<Base &>(*this)));
+        }
+
+        /// Read-only view as a dynamic buffer (for writers, meters, ...)
+        const Base &dynamic() const noexcept
+        {
+            return *this;
+        }
+
+        using Base::operator();
+        using Base::channel;
+        using Base::clear;
+        using Base::copy_from_planar;
+        using Base::copy_to_planar;
+        using Base::data;
+        using Base::empty;
+        using Base::get_channel;
+        using Base::num_samples;
+        using Base::remap_channels;
+        using Base::samples;
+        using Base::set_channel;
+        using Base::size_in_bytes;
+        using Base::apply_gain;
+        using Base::apply_gain_ramp;
+
+        static constexpr size_t num_channels() noexcept
+        {
+            return Channels;
+        }
+
+        size_t total_samples() const noexcept
+        {
+            return this->num_samples() * Channels;
+        }
+
+        SampleType &at_unchecked(size_t sample_index, size_t channel) noexcept
+        {
+            assert(sample_index < this->num_samples() && channel < Channels);
+            return this->data()[sample_index * Channels + channel];
+        }
+
+        const SampleType &at_unchecked(size_t sample_index, size_t channel) const noexcept
+        {
+            assert(sample_index < this->num_samples() && channel < Channels);
+            return this->data()[sample_index * Channels + channel];
+        }
+
+        std::span<SampleType, Channels> frame(size_t sample_index)
+        {
+            return Base::frame(sample_index).template first<Channels>();
+        }
+
+        std::span<const SampleType, Channels> frame(size_t sample_index) const
+        {
+            return Base::frame(sample_index).template first<Channels>();
+        }
+
+        FrameRange<SampleType, Channels> frames() noexcept
+        {
+            return {this->data(), this->num_samples(), Channels};
+        }
+
+        FrameRange<const SampleType, Channels> frames() const noexcept
+        {
+            return {this->data(), this->num_samples(), Channels};
+        }
+
+        FrameRange<SampleType, Channels> frames(size_t first, size_t count)
+        {
+            Base::frames(first, count); // Range check
+            return {this->data() + first * Channels, count, Channels};
+        }
+
+        FrameRange<const SampleType, Channels> frames(size_t first, size_t count) const
+        {
+            Base::frames(first, count);
+            return {this->data() + first * Channels, count, Channels};
+        }
+
+        // Mix (add) another buffer with the same layout into this one
+        void mix(const AudioBuffer &other, float gain = 1.0f)
+        {
+            Base::mix(other, gain);
+        }
+
+        void mix(const Base &other, float gain = 1.0f)
+        {
+            Base::mix(other, gain);
+        }
+
+        void mix_ramp(const AudioBuffer &other, float start_gain, float end_gain)
+        {
+            Base::mix_ramp(other, start_gain, end_gain);
+        }
+
+        void mix_ramp(const Base &other, float start_gain, float end_gain)
+        {
+            Base::mix_ramp(other, start_gain, end_gain);
+        }
+
+        /**
+         * @brief Resize buffer (destroys existing data)
+         */
+        void resize(size_t new_num_samples)
+        {
+            Base::resize(new_num_samples, Channels);
+        }
+
+        void resize(size_t new_num_samples, size_t new_num_channels)
+        {
+            Base::resize(new_num_samples, checked_channels(new_num_channels));
+        }
+
+    private:
+        static size_t checked_channels(size_t num_channels)
+        {
+            if (num_channels != Channels)
+            {
+                throw std::invalid_argument("Channel count does not match fixed buffer layout");
+            }
+            return num_channels;
+        }
 
-            for (size_t i = 0; i < total_samples(); ++i)
+        static Base &&checked_adopt(Base &&other)
+        {
+            if (!other.empty() && other.num_channels() != Channels)
             {
-                buffer_[i] = static_cast<SampleType>(
-                    buffer_[i] + other.buffer_[i] * gain);
+                throw std::invalid_argument("Channel count does not match fixed buffer layout");
             }
+            return std::move(other);
         }
-    }; // class AudioBuffer
+    }; // class AudioBuffer<SampleType, Channels>
+
+    template <typename SampleType>
+    using MonoBuffer = AudioBuffer<SampleType, 1>;
+
+    template <typename SampleType>
+    using StereoBuffer = AudioBuffer<SampleType, 2>;
 } // namespace audio
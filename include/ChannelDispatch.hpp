@@ -0,0 +1,103 @@
+#pragma once
+
+#include "project.h"
+
+namespace audio
+{
+    /**
+     * @brief Channel count marker for buffers/kernels sized at runtime
+     *
+     * Shares its value with std::dynamic_extent so a compile-time channel
+     * count can be used directly as a std::span extent.
+     */
+    inline constexpr size_t dynamic_channels = std::dynamic_extent;
+
+    /**
+     * @brief Channel count a kernel actually loops over
+     *
+     * Folds to a constant for fixed specialisations, falls back to the
+     * runtime count for dynamic_channels.
+     */
+    template <size_t Channels>
+    constexpr size_t resolve_channels(size_t runtime_channels) noexcept
+    {
+        if constexpr (Channels == dynamic_channels)
+            return runtime_channels;
+        else
+            return Channels;
+    }
+
+    /**
+     * @brief Pick a compile-time channel specialisation at runtime
+     *
+     * Calls func with std::integral_constant<size_t, N> for N = 1, 2, 4, 8
+     * and with dynamic_channels for every other count, so a kernel written as
+     * a generic lambda gets fully unrolled inner loops on the common layouts.
+     */
+    template <typename Func>
+    decltype(auto) dispatch_channels(size_t num_channels, Func &&func)
+    {
+        switch (num_channels)
+        {
+        case 1:
+            return func(std::integral_constant<size_t, 1>{});
+        case 2:
+            return func(std::integral_constant<size_t, 2>{});
+        case 4:
+            return func(std::integral_constant<size_t, 4>{});
+        case 8:
+            return func(std::integral_constant<size_t, 8>{});
+        default:
+            return func(std::integral_constant<size_t, dynamic_channels>{});
+        }
+    }
+
+    /**
+     * @brief Cover interleaved channels with fixed-width lane groups
+     *
+     * Calls func(std::integral_constant<size_t, Lanes>{}, first) for each
+     * group of channels [first, first + Lanes). 1, 2, 4 and 8 channels (up
+     * to MaxLanes) are one group; other counts are split into MaxLanes-wide
+     * groups plus a 4 + 2 + 1 remainder, so every lane loop has a constant
+     * trip count.
+     */
+    template <size_t MaxLanes, typename Func>
+    void for_each_lane_group(size_t num_channels, Func &&func)
+    {
+        static_assert(MaxLanes >= 1 && MaxLanes <= 8, "Remainder groups cover at most 7 channels");
+
+        dispatch_channels(num_channels, [&](auto channels)
+        {
+            constexpr size_t Channels = decltype(channels)::value;
+
+            if constexpr (Channels != dynamic_channels && Channels <= MaxLanes)
+            {
+                func(std::integral_constant<size_t, Channels>{}, size_t(0));
+            }
+            else
+            {
+                size_t first = 0;
+                for (; first + MaxLanes <= num_channels; first += MaxLanes)
+                {
+                    func(std::integral_constant<size_t, MaxLanes>{}, first);
+                }
+
+                const size_t remaining = num_channels - first;
+                if (remaining & 4)
+                {
+                    func(std::integral_constant<size_t, 4>{}, first);
+                    first += 4;
+                }
+                if (remaining & 2)
+                {
+                    func(std::integral_constant<size_t, 2>{}, first);
+                    first += 2;
+                }
+                if (remaining & 1)
+                {
+                    func(std::integral_constant<size_t, 1>{}, first);
+                }
+            }
+        });
+    }
+} // namespace audio
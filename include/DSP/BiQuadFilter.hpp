@@ -1,6 +1,9 @@
 #pragma once
 
 #include "project.h"
+#include "ChannelDispatch.hpp"
+#include "DSP/BiquadTopology.hpp"
+#include "SIMD/SimdConfig.hpp"
 
 namespace audio
 {
@@ -21,9 +24,9 @@ namespace audio
             double a2 = 0.0;
 
             // Normalize coefficients (divide by a0)
-            void normalize()
+            constexpr void normalize()
             {
-                if (std::abs(a0) < 1e-10)
+                if ((a0 < 0.0 ? -a0 : a0) < 1e-10)
                 {
                     a0 = 1.0; // Prevent division by zero
                 }
@@ -58,17 +61,40 @@ namespace audio
         /**
          * Biquad filter processor
          * Template allows different sample types (float, double)
+         *
+         * Policy selects precision and topology (see BiquadTopology.hpp);
+         * the default DoubleDF1 computes in double with Direct Form I.
+         *
+         * Per-channel history is kept as structure-of-arrays (one array per
+         * state term), so process_buffer() can run up to max_lanes channels
+         * side by side in vector registers during one sweep over the frames
+         * (the lane loop carries AUDIO_SIMD_LANES; see SimdConfig.hpp).
+         *
+         * For modulation, set_coefficients(coeffs, ramp_samples) glides to the
+         * new coefficients by per-sample linear interpolation inside
+         * process_buffer(). Stable (a1, a2) pairs form a convex triangle, so
+         * every intermediate filter between two stable ones is stable too.
          */
-        template <typename SampleType>
+        template <typename SampleType, typename Policy = DoubleDF1>
         class BiquadFilter
         {
         public:
-            BiquadFilter() = default;
+            using value_type = typename Policy::value_type;
+            static constexpr size_t state_size = Policy::state_size;
+
+            /// Channels processed together per sweep over interleaved frames
+            static constexpr size_t max_lanes = 8;
+
+            BiquadFilter()
+            {
+                update_lane_coefficients();
+            }
 
             explicit BiquadFilter(const BiquadCoefficients &coeffs)
                 : coeffs_(coeffs)
             {
                 coeffs_.normalize();
+                update_lane_coefficients();
             }
 
             // Set new coefficients
@@ -76,29 +102,65 @@ namespace audio
             {
                 coeffs_ = coeffs;
                 coeffs_.normalize();
+                update_lane_coefficients();
+                ramp_remaining_ = 0;
             }
 
-            // Process single sample for one channel
-            SampleType process_sample(SampleType input, size_t channel = 0)
+            /**
+             * Glide to new coefficients over ramp_samples frames
+             * Call at control rate (e.g. once per block); process_buffer()
+             * interpolates per sample, process_sample() does not advance the
+             * ramp. A new ramp starts from wherever a running one has got to.
+             */
+            void set_coefficients(const BiquadCoefficients &coeffs, size_t ramp_samples)
             {
-                // Ensure we have state for this channel
-                if (channel >= states_.size())
+                if (ramp_samples == 0)
                 {
-                    states_.resize(channel + 1);
+                    set_coefficients(coeffs);
+                    return;
                 }
 
-                auto &state = states_[channel];
+                coeffs_ = coeffs;
+                coeffs_.normalize();
+
+                const BiquadLaneCoefficients<value_type> target = to_lane_coefficients(coeffs_);
+                const value_type inv = value_type(1) / static_cast<value_type>(ramp_samples);
+                ramp_step_.b0 = (target.b0 - lane_coeffs_.b0) * inv;
+                ramp_step_.b1 = (target.b1 - lane_coeffs_.b1) * inv;
+                ramp_step_.b2 = (target.b2 - lane_coeffs_.b2) * inv;
+                ramp_step_.a1 = (target.a1 - lane_coeffs_.a1) * inv;
+                ramp_step_.a2 = (target.a2 - lane_coeffs_.a2) * inv;
+                ramp_remaining_ = ramp_samples;
+            }
+
+            // True while a coefficient ramp is in progress
+            bool is_ramping() const
+            {
+                return ramp_remaining_ > 0;
+            }
+
+            // Allocate state for num_channels up front (processing then never allocates)
+            void prepare(size_t num_channels)
+            {
+                if (num_channels > state_[0].size())
+                {
+                    for (auto &row : state_)
+                    {
+                        row.resize(num_channels, value_type(0));
+                    }
+                }
+            }
 
-                // Apply biquad difference equation
-                // y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
-                double x = static_cast<double>(input);
-                double y = coeffs_.b0 * x + coeffs_.b1 * state.x1 + coeffs_.b2 * state.x2 - coeffs_.a1 * state.y1 - coeffs_.a2 * state.y2;
+            // Process single sample for one channel
+            SampleType process_sample(SampleType input, size_t channel = 0)
+            {
+                // Ensure we have state for this channel
+                prepare(channel + 1);
 
-                // Update state (shift samples)
-                state.x2 = state.x1;
-                state.x1 = x;
-                state.y2 = state.y1;
-                state.y1 = y;
+                value_type s[state_size][1];
+                load_lanes<1>(s, channel);
+                const value_type y = Policy::template tick<1>(lane_coeffs_, s, 0, static_cast<value_type>(input));
+                store_lanes<1>(s, channel);
 
                 return static_cast<SampleType>(y);
             }
@@ -106,22 +168,24 @@ namespace audio
             // Process entire buffer (interleaved stereo/mono)
             void process_buffer(SampleType *buffer, size_t num_samples, size_t num_channels)
             {
-                for (size_t sample = 0; sample < num_samples; ++sample)
+                prepare(num_channels);
+
+                // Interpolated head while a ramp is running, fixed coefficients after
+                const size_t ramped = std::min(num_samples, ramp_remaining_);
+                if (ramped > 0)
                 {
-                    for (size_t ch = 0; ch < num_channels; ++ch)
-                    {
-                        size_t index = sample * num_channels + ch;
-                        buffer[index] = process_sample(buffer[index], ch);
-                    }
+                    process_frames<true>(buffer, ramped, num_channels);
+                    advance_ramp(ramped);
                 }
+                process_frames<false>(buffer + ramped * num_channels, num_samples - ramped, num_channels);
             }
 
             // Reset filter state (clear history)
             void reset()
             {
-                for (auto &state : states_)
+                for (auto &row : state_)
                 {
-                    state.reset();
+                    std::fill(row.begin(), row.end(), value_type(0));
                 }
             }
 
@@ -131,9 +195,160 @@ namespace audio
                 return coeffs_;
             }
 
+            // Number of channels with allocated state
+            size_t num_channels() const
+            {
+                return state_[0].size();
+            }
+
+            // Snapshot of one channel's history (Direct Form I only)
+            BiquadState state(size_t channel) const
+                requires(state_size == 4)
+            {
+                if (channel >= num_channels())
+                {
+                    return {};
+                }
+                return {static_cast<double>(state_[0][channel]), static_cast<double>(state_[1][channel]),
+                        static_cast<double>(state_[2][channel]), static_cast<double>(state_[3][channel])};
+            }
+
+            /**
+             * Overwrite one channel's history from Direct Form I values
+             * Transposed forms derive the equivalent internal state.
+             */
+            void set_state(size_t channel, const BiquadState &state)
+            {
+                prepare(channel + 1);
+                if constexpr (state_size == 4)
+                {
+                    state_[0][channel] = static_cast<value_type>(state.x1);
+                    state_[1][channel] = static_cast<value_type>(state.x2);
+                    state_[2][channel] = static_cast<value_type>(state.y1);
+                    state_[3][channel] = static_cast<value_type>(state.y2);
+                }
+                else
+                {
+                    state_[0][channel] = static_cast<value_type>(coeffs_.b1 * state.x1 + coeffs_.b2 * state.x2 - coeffs_.a1 * state.y1 - coeffs_.a2 * state.y2);
+                    state_[1][channel] = static_cast<value_type>(coeffs_.b2 * state.x1 - coeffs_.a2 * state.y1);
+                }
+            }
+
         private:
+            static BiquadLaneCoefficients<value_type> to_lane_coefficients(const BiquadCoefficients &coeffs)
+            {
+                return {static_cast<value_type>(coeffs.b0), static_cast<value_type>(coeffs.b1),
+                        static_cast<value_type>(coeffs.b2), static_cast<value_type>(coeffs.a1),
+                        static_cast<value_type>(coeffs.a2)};
+            }
+
+            void update_lane_coefficients()
+            {
+                lane_coeffs_ = to_lane_coefficients(coeffs_);
+            }
+
+            // Current coefficients advanced by k ramp steps
+            BiquadLaneCoefficients<value_type> ramp_coefficients(value_type k) const
+            {
+                return {lane_coeffs_.b0 + ramp_step_.b0 * k, lane_coeffs_.b1 + ramp_step_.b1 * k,
+                        lane_coeffs_.b2 + ramp_step_.b2 * k, lane_coeffs_.a1 + ramp_step_.a1 * k,
+                        lane_coeffs_.a2 + ramp_step_.a2 * k};
+            }
+
+            void advance_ramp(size_t frames)
+            {
+                ramp_remaining_ -= frames;
+                if (ramp_remaining_ == 0)
+                {
+                    update_lane_coefficients(); // Land exactly on the target
+                }
+                else
+                {
+                    lane_coeffs_ = ramp_coefficients(static_cast<value_type>(frames));
+                }
+            }
+
+            template <size_t Lanes>
+            void load_lanes(value_type (&s)[state_size][Lanes], size_t first) const
+            {
+                for (size_t row = 0; row < state_size; ++row)
+                {
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        s[row][lane] = state_[row][first + lane];
+                    }
+                }
+            }
+
+            template <size_t Lanes>
+            void store_lanes(const value_type (&s)[state_size][Lanes], size_t first)
+            {
+                for (size_t row = 0; row < state_size; ++row)
+                {
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        state_[row][first + lane] = s[row][lane];
+                    }
+                }
+            }
+
+            // Run frames through lane groups of up to max_lanes channels
+            template <bool Ramped>
+            void process_frames(SampleType *buffer, size_t num_samples, size_t num_channels)
+            {
+                if (num_samples == 0)
+                    return;
+
+                for_each_lane_group<max_lanes>(num_channels, [&](auto lanes, size_t first)
+                {
+                    process_lanes<decltype(lanes)::value, Ramped>(buffer, num_samples, num_channels, first);
+                });
+            }
+
+            /**
+             * Sweep all frames for channels [first, first + Lanes)
+             * State lives in local lane arrays for the whole sweep. The
+             * fixed-width lane loop is marked AUDIO_SIMD_LANES so it compiles
+             * to one packed operation per term instead of being unrolled into
+             * scalar code.
+             * Ramped sweeps step the coefficients once per frame.
+             */
+            template <size_t Lanes, bool Ramped>
+            void process_lanes(SampleType *buffer, size_t num_samples, size_t stride, size_t first)
+            {
+                value_type s[state_size][Lanes];
+                load_lanes<Lanes>(s, first);
+
+                BiquadLaneCoefficients<value_type> c = lane_coeffs_;
+
+                for (size_t sample = 0; sample < num_samples; ++sample)
+                {
+                    if constexpr (Ramped)
+                    {
+                        c = ramp_coefficients(static_cast<value_type>(sample + 1));
+                    }
+
+                    SampleType *frame = buffer + sample * stride + first;
+                    AUDIO_SIMD_LANES
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        frame[lane] = static_cast<SampleType>(
+                            Policy::template tick<Lanes>(c, s, lane, static_cast<value_type>(frame[lane])));
+                    }
+                }
+
+                store_lanes<Lanes>(s, first);
+            }
+
             BiquadCoefficients coeffs_;
-            std::vector<BiquadState> states_; // One state per channel
+            BiquadLaneCoefficients<value_type> lane_coeffs_;
+
+            // Per-sample increments while gliding towards coeffs_
+            BiquadLaneCoefficients<value_type> ramp_step_;
+            size_t ramp_remaining_ = 0;
+
+            // Structure-of-arrays history, one row per state term, one entry per channel
+            std::array<std::vector<value_type>, state_size> state_;
         };
 
     } // namespace dsp
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "DSP/BiQuadFilter.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Cascade of second-order sections (SOS) processed in one pass
+         *
+         * The buffer is walked in blocks small enough to stay in L1 and every
+         * enabled section runs over a block before moving on, so an N-section
+         * cascade streams the buffer through memory once instead of N times.
+         * Results match running the sections one after another.
+         * Policy selects precision/topology for every section.
+         */
+        template <typename SampleType, typename Policy = DoubleDF1>
+        class BiquadCascade
+        {
+        public:
+            /// Target size of one block of interleaved samples
+            static constexpr size_t block_bytes = 16 * 1024;
+
+            BiquadCascade() = default;
+
+            explicit BiquadCascade(const std::vector<BiquadCoefficients> &sections)
+            {
+                for (const auto &coeffs : sections)
+                {
+                    add_section(coeffs);
+                }
+            }
+
+            /**
+             * Append a section
+             * @return Index of the added section
+             */
+            size_t add_section(const BiquadCoefficients &coeffs)
+            {
+                sections_.emplace_back(coeffs);
+                enabled_.push_back(true);
+                sections_.back().prepare(num_channels_);
+                return sections_.size() - 1;
+            }
+
+            void remove_section(size_t index)
+            {
+                if (index < sections_.size())
+                {
+                    sections_.erase(sections_.begin() + index);
+                    enabled_.erase(enabled_.begin() + index);
+                }
+            }
+
+            void set_section(size_t index, const BiquadCoefficients &coeffs)
+            {
+                sections_.at(index).set_coefficients(coeffs);
+            }
+
+            // Disabled sections are skipped entirely (their state is kept)
+            void set_section_enabled(size_t index, bool enabled)
+            {
+                if (index < enabled_.size())
+                {
+                    enabled_[index] = enabled;
+                }
+            }
+
+            void clear()
+            {
+                sections_.clear();
+                enabled_.clear();
+            }
+
+            size_t num_sections() const { return sections_.size(); }
+            bool is_section_enabled(size_t index) const { return enabled_.at(index); }
+            const BiquadCoefficients &section(size_t index) const { return sections_.at(index).coefficients(); }
+
+            // Overwrite one section's history for a channel (Direct Form I values)
+            void set_section_state(size_t index, size_t channel, const BiquadState &state)
+            {
+                prepare(channel + 1);
+                sections_.at(index).set_state(channel, state);
+            }
+
+            // Allocate state for num_channels in every section
+            void prepare(size_t num_channels)
+            {
+                num_channels_ = std::max(num_channels_, num_channels);
+                for (auto &section : sections_)
+                {
+                    section.prepare(num_channels_);
+                }
+            }
+
+            // Process single sample for one channel through all enabled sections
+            SampleType process_sample(SampleType input, size_t channel = 0)
+            {
+                for (size_t i = 0; i < sections_.size(); ++i)
+                {
+                    if (enabled_[i])
+                    {
+                        input = sections_[i].process_sample(input, channel);
+                    }
+                }
+                return input;
+            }
+
+            // Process entire buffer (interleaved stereo/mono)
+            void process_buffer(SampleType *buffer, size_t num_samples, size_t num_channels)
+            {
+                if (num_channels == 0)
+                    return;
+
+                ScopedNoDenormals no_denormals;
+                prepare(num_channels);
+
+                const size_t block_frames = std::max<size_t>(16, block_bytes / (sizeof(SampleType) * num_channels));
+
+                for (size_t start = 0; start < num_samples; start += block_frames)
+                {
+                    const size_t count = std::min(block_frames, num_samples - start);
+                    SampleType *block = buffer + start * num_channels;
+
+                    for (size_t i = 0; i < sections_.size(); ++i)
+                    {
+                        if (enabled_[i])
+                        {
+                            sections_[i].process_buffer(block, count, num_channels);
+                        }
+                    }
+                }
+            }
+
+            // Reset filter state (clear history)
+            void reset()
+            {
+                for (auto &section : sections_)
+                {
+                    section.reset();
+                }
+            }
+
+        private:
+            std::vector<BiquadFilter<SampleType, Policy>> sections_;
+            std::vector<bool> enabled_;
+            size_t num_channels_ = 0;
+        };
+
+    } // namespace dsp
+} // namespace audio
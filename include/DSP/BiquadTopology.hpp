@@ -0,0 +1,93 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/Denormals.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Biquad coefficients in the precision a topology computes in
+         * (a0 is always normalised to 1)
+         */
+        template <typename T>
+        struct BiquadLaneCoefficients
+        {
+            T b0 = 1;
+            T b1 = 0;
+            T b2 = 0;
+            T a1 = 0;
+            T a2 = 0;
+        };
+
+        /**
+         * Precision/topology policies for BiquadFilter
+         *
+         * A policy fixes the arithmetic type and the difference-equation
+         * structure. State is kept per lane as state_size arrays so the filter
+         * can hold it in structure-of-arrays form. Feedback terms go through
+         * flush_denormal() on every tick.
+         */
+        namespace topology
+        {
+            /**
+             * Direct Form I
+             * Four state values (x1, x2, y1, y2); robust to coefficient changes
+             * and the most accurate at very low cutoffs in double precision.
+             */
+            template <typename T>
+            struct DirectForm1
+            {
+                using value_type = T;
+                static constexpr size_t state_size = 4;
+
+                // state rows: 0 = x[n-1], 1 = x[n-2], 2 = y[n-1], 3 = y[n-2]
+                template <size_t Lanes>
+                static T tick(const BiquadLaneCoefficients<T> &c, T (&s)[state_size][Lanes], size_t lane, T x)
+                {
+                    // y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+                    const T y = flush_denormal(c.b0 * x + c.b1 * s[0][lane] + c.b2 * s[1][lane] - c.a1 * s[2][lane] - c.a2 * s[3][lane]);
+
+                    s[1][lane] = s[0][lane];
+                    s[0][lane] = x;
+                    s[3][lane] = s[2][lane];
+                    s[2][lane] = y;
+                    return y;
+                }
+            };
+
+            /**
+             * Transposed Direct Form II
+             * Two state values and fewer operations per sample; in float it
+             * doubles the SIMD width at a small accuracy cost.
+             */
+            template <typename T>
+            struct TransposedDirectForm2
+            {
+                using value_type = T;
+                static constexpr size_t state_size = 2;
+
+                template <size_t Lanes>
+                static T tick(const BiquadLaneCoefficients<T> &c, T (&s)[state_size][Lanes], size_t lane, T x)
+                {
+                    const T y = c.b0 * x + s[0][lane];
+                    s[0][lane] = flush_denormal(c.b1 * x - c.a1 * y + s[1][lane]);
+                    s[1][lane] = flush_denormal(c.b2 * x - c.a2 * y);
+                    return y;
+                }
+            };
+        } // namespace topology
+
+        /// Double precision Direct Form I (reference behaviour, default)
+        using DoubleDF1 = topology::DirectForm1<double>;
+
+        /// Double precision Transposed Direct Form II
+        using DoubleTDF2 = topology::TransposedDirectForm2<double>;
+
+        /// Single precision Transposed Direct Form II (fastest for float buffers)
+        using FloatTDF2 = topology::TransposedDirectForm2<float>;
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/FilterDesign.hpp"
+
+#include <complex>
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Higher-order filter designers
+         * Each returns the second-order sections (SOS) of an Nth-order
+         * design, ready for BiquadCascade, so an 8th-order slope costs one
+         * pass over the buffer instead of four stacked effects.
+         *
+         * Designs start from the analog lowpass prototype (poles/zeros at
+         * 1 rad/s), map to lowpass or highpass and go through the bilinear
+         * transform with the cutoff prewarped. Odd orders end in a genuine
+         * first-order section (b2 = a2 = 0). Sections are ordered by
+         * increasing Q so the resonant ones come last.
+         */
+        class CascadeDesign
+        {
+        public:
+            /// Highest supported order
+            static constexpr int max_order = 32;
+
+            /**
+             * Butterworth: maximally flat, -3 dB at cutoff
+             * @param order Filter order (1..max_order), slope 6*order dB/octave
+             */
+            static std::vector<BiquadCoefficients> butterworth_lowpass(double sample_rate, double cutoff_freq, int order)
+            {
+                return design(sample_rate, cutoff_freq, butterworth_prototype(order), false);
+            }
+
+            static std::vector<BiquadCoefficients> butterworth_highpass(double sample_rate, double cutoff_freq, int order)
+            {
+                return design(sample_rate, cutoff_freq, butterworth_prototype(order), true);
+            }
+
+            /**
+             * Linkwitz-Riley: squared Butterworth, -6 dB at cutoff
+             * Lowpass + highpass of the same order sum to an allpass (flat
+             * magnitude). For LR2 / LR6 the highpass must be polarity-inverted
+             * before summing.
+             * @param order Even order (2, 4, 8, ...)
+             */
+            static std::vector<BiquadCoefficients> linkwitz_riley_lowpass(double sample_rate, double cutoff_freq, int order)
+            {
+                return design(sample_rate, cutoff_freq, linkwitz_riley_prototype(order), false);
+            }
+
+            static std::vector<BiquadCoefficients> linkwitz_riley_highpass(double sample_rate, double cutoff_freq, int order)
+            {
+                return design(sample_rate, cutoff_freq, linkwitz_riley_prototype(order), true);
+            }
+
+            /**
+             * Allpass equal to the summed Linkwitz-Riley pair at cutoff
+             * (lowpass + highpass, highpass inverted for LR2 / LR6). Bands of
+             * a multiband split that bypass a crossover point go through it
+             * to stay phase-aligned with the bands that were split there.
+             * Butterworth poles of half the order with mirrored zeros.
+             */
+            static std::vector<BiquadCoefficients> linkwitz_riley_allpass(double sample_rate, double cutoff_freq, int order)
+            {
+                if (order < 2 || order % 2 != 0 || order > max_order)
+                {
+                    throw std::invalid_argument("Linkwitz-Riley order must be even (2, 4, 8, ...)");
+                }
+
+                std::vector<BiquadCoefficients> sections = butterworth_lowpass(sample_rate, cutoff_freq, order / 2);
+                for (auto &section : sections)
+                {
+                    // Numerator is the denominator reversed
+                    if (section.a2 == 0.0)
+                    {
+                        section.b0 = section.a1;
+                        section.b1 = 1.0;
+                        section.b2 = 0.0;
+                    }
+                    else
+                    {
+                        section.b0 = section.a2;
+                        section.b1 = section.a1;
+                        section.b2 = 1.0;
+                    }
+                }
+                return sections;
+            }
+
+            /**
+             * Chebyshev type I: equiripple passband, steeper than Butterworth
+             * The cutoff is the passband edge, where the gain is -ripple_db.
+             * @param ripple_db Passband ripple in dB (> 0)
+             */
+            static std::vector<BiquadCoefficients> chebyshev1_lowpass(double sample_rate, double cutoff_freq,
+                                                                      int order, double ripple_db)
+            {
+                return design(sample_rate, cutoff_freq, chebyshev1_prototype(order, ripple_db), false);
+            }
+
+            static std::vector<BiquadCoefficients> chebyshev1_highpass(double sample_rate, double cutoff_freq,
+                                                                       int order, double ripple_db)
+            {
+                return design(sample_rate, cutoff_freq, chebyshev1_prototype(order, ripple_db), true);
+            }
+
+            /**
+             * Chebyshev type II: flat passband, equiripple stopband
+             * The cutoff is the stopband edge, beyond which the gain stays
+             * at or below -stopband_db.
+             * @param stopband_db Minimum stopband attenuation in dB (> 0)
+             */
+            static std::vector<BiquadCoefficients> chebyshev2_lowpass(double sample_rate, double cutoff_freq,
+                                                                      int order, double stopband_db)
+            {
+                return design(sample_rate, cutoff_freq, chebyshev2_prototype(order, stopband_db), false);
+            }
+
+            static std::vector<BiquadCoefficients> chebyshev2_highpass(double sample_rate, double cutoff_freq,
+                                                                       int order, double stopband_db)
+            {
+                return design(sample_rate, cutoff_freq, chebyshev2_prototype(order, stopband_db), true);
+            }
+
+        private:
+            /**
+             * Analog section (n2 s^2 + n1 s + n0) / (d2 s^2 + d1 s + d0)
+             * First-order sections have n2 = d2 = 0.
+             */
+            struct AnalogSection
+            {
+                double n2, n1, n0;
+                double d2, d1, d0;
+            };
+
+            using Prototype = std::vector<AnalogSection>;
+
+            static void validate_order(int order)
+            {
+                if (order < 1 || order > max_order)
+                {
+                    throw std::invalid_argument("Filter order must be between 1 and " + std::to_string(max_order));
+                }
+            }
+
+            // Angle of the k-th prototype pole pair, measured from the imaginary axis
+            static double pole_angle(int k, int order)
+            {
+                return PI * (2.0 * k + 1.0) / (2.0 * order);
+            }
+
+            static Prototype butterworth_prototype(int order)
+            {
+                validate_order(order);
+
+                Prototype sections;
+                if (order % 2 == 1)
+                {
+                    sections.push_back({0.0, 0.0, 1.0, 0.0, 1.0, 1.0});
+                }
+                // k from the outermost pair inwards: increasing Q
+                for (int k = order / 2 - 1; k >= 0; --k)
+                {
+                    const double two_zeta = 2.0 * std::sin(pole_angle(k, order)); // 1/Q
+                    sections.push_back({0.0, 0.0, 1.0, 1.0, two_zeta, 1.0});
+                }
+                return sections;
+            }
+
+            static Prototype linkwitz_riley_prototype(int order)
+            {
+                if (order < 2 || order % 2 != 0 || order > max_order)
+                {
+                    throw std::invalid_argument("Linkwitz-Riley order must be even (2, 4, 8, ...)");
+                }
+
+                Prototype sections;
+                for (const auto &section : butterworth_prototype(order / 2))
+                {
+                    if (section.d2 == 0.0)
+                    {
+                        // (s + 1)^2 as one second-order section, Q = 0.5
+                        sections.push_back({0.0, 0.0, 1.0, 1.0, 2.0, 1.0});
+                    }
+                    else
+                    {
+                        sections.push_back(section);
+                        sections.push_back(section);
+                    }
+                }
+                return sections;
+            }
+
+            static Prototype chebyshev1_prototype(int order, double ripple_db)
+            {
+                validate_order(order);
+                if (ripple_db <= 0.0)
+                {
+                    throw std::invalid_argument("Passband ripple must be positive");
+                }
+
+                const double epsilon = std::sqrt(std::pow(10.0, ripple_db / 10.0) - 1.0);
+                const double mu = std::asinh(1.0 / epsilon) / order;
+                const double sigma = std::sinh(mu);
+                const double omega = std::cosh(mu);
+
+                Prototype sections;
+                if (order % 2 == 1)
+                {
+                    sections.push_back({0.0, 0.0, sigma, 0.0, 1.0, sigma});
+                }
+                for (int k = order / 2 - 1; k >= 0; --k)
+                {
+                    const double re = sigma * std::sin(pole_angle(k, order));
+                    const double im = omega * std::cos(pole_angle(k, order));
+                    const double mag2 = re * re + im * im;
+                    sections.push_back({0.0, 0.0, mag2, 1.0, 2.0 * re, mag2});
+                }
+
+                // Even orders start the ripple at the bottom: DC gain 1/sqrt(1+eps^2)
+                if (order % 2 == 0)
+                {
+                    sections.front().n0 /= std::sqrt(1.0 + epsilon * epsilon);
+                }
+                return sections;
+            }
+
+            static Prototype chebyshev2_prototype(int order, double stopband_db)
+            {
+                validate_order(order);
+                if (stopband_db <= 0.0)
+                {
+                    throw std::invalid_argument("Stopband attenuation must be positive");
+                }
+
+                const double epsilon = 1.0 / std::sqrt(std::pow(10.0, stopband_db / 10.0) - 1.0);
+                const double mu = std::asinh(1.0 / epsilon) / order;
+                const double sigma = std::sinh(mu);
+                const double omega = std::cosh(mu);
+
+                Prototype sections;
+                if (order % 2 == 1)
+                {
+                    // Inverse of the real Chebyshev I pole -sigma; zero at infinity
+                    const double pole = 1.0 / sigma;
+                    sections.push_back({0.0, 0.0, pole, 0.0, 1.0, pole});
+                }
+                for (int k = order / 2 - 1; k >= 0; --k)
+                {
+                    // Poles are inverses of the Chebyshev I poles
+                    const double re = sigma * std::sin(pole_angle(k, order));
+                    const double im = omega * std::cos(pole_angle(k, order));
+                    const std::complex<double> pole = 1.0 / std::complex<double>(-re, im);
+                    const double d1 = -2.0 * pole.real();
+                    const double d0 = std::norm(pole);
+
+                    // Zeros on the imaginary axis at +-j / cos(theta)
+                    const double zero2 = 1.0 / std::pow(std::cos(pole_angle(k, order)), 2);
+
+                    // Unity DC gain per section
+                    const double g = d0 / zero2;
+                    sections.push_back({g, 0.0, g * zero2, 1.0, d1, d0});
+                }
+                return sections;
+            }
+
+            /**
+             * Map prototype to lowpass/highpass at cutoff and apply the
+             * bilinear transform s = c (1 - z^-1) / (1 + z^-1)
+             */
+            static std::vector<BiquadCoefficients> design(double sample_rate, double cutoff_freq,
+                                                          const Prototype &prototype, bool highpass)
+            {
+                if (cutoff_freq <= 0.0 || cutoff_freq >= sample_rate / 2.0)
+                {
+                    throw std::invalid_argument(
+                        "Frequency must be between 0 and Nyquist frequency (" + std::to_string(sample_rate / 2.0) + " Hz)");
+                }
+
+                // Prewarp: analog 1 rad/s lands exactly on cutoff_freq
+                const double c = 1.0 / std::tan(PI * cutoff_freq / sample_rate);
+
+                std::vector<BiquadCoefficients> result;
+                result.reserve(prototype.size());
+
+                for (AnalogSection s : prototype)
+                {
+                    if (highpass)
+                    {
+                        // s -> 1/s, then clear the s^2 denominator
+                        if (s.d2 == 0.0)
+                        {
+                            s = {0.0, s.n0, s.n1, 0.0, s.d0, s.d1};
+                        }
+                        else
+                        {
+                            s = {s.n0, s.n1, s.n2, s.d0, s.d1, s.d2};
+                        }
+                    }
+
+                    BiquadCoefficients coeffs;
+                    if (s.d2 == 0.0)
+                    {
+                        // First order: (n1 s + n0) / (d1 s + d0)
+                        coeffs.b0 = s.n1 * c + s.n0;
+                        coeffs.b1 = -s.n1 * c + s.n0;
+                        coeffs.b2 = 0.0;
+                        coeffs.a0 = s.d1 * c + s.d0;
+                        coeffs.a1 = -s.d1 * c + s.d0;
+                        coeffs.a2 = 0.0;
+                    }
+                    else
+                    {
+                        const double c2 = c * c;
+                        coeffs.b0 = s.n2 * c2 + s.n1 * c + s.n0;
+                        coeffs.b1 = 2.0 * (s.n0 - s.n2 * c2);
+                        coeffs.b2 = s.n2 * c2 - s.n1 * c + s.n0;
+                        coeffs.a0 = s.d2 * c2 + s.d1 * c + s.d0;
+                        coeffs.a1 = 2.0 * (s.d0 - s.d2 * c2);
+                        coeffs.a2 = s.d2 * c2 - s.d1 * c + s.d0;
+                    }
+
+                    coeffs.normalize();
+                    result.push_back(coeffs);
+                }
+                return result;
+            }
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/FilterDesign.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Filter shapes understood by design_filter() / CoefficientCache
+         */
+        enum class FilterType
+        {
+            Lowpass,
+            Highpass,
+            Bandpass,
+            Notch,
+            PeakingEQ,
+            LowShelf,
+            HighShelf,
+            Allpass
+        };
+
+        /**
+         * Complete description of one biquad design
+         * shape is Q (low/high/all-pass), bandwidth (band-pass, notch,
+         * peaking) or slope (shelves); gain_db is ignored where unused.
+         */
+        struct FilterSpec
+        {
+            FilterType type = FilterType::Lowpass;
+            double sample_rate = 44100.0;
+            double frequency = 1000.0;
+            double shape = 0.707;
+            double gain_db = 0.0;
+
+            bool operator==(const FilterSpec &) const = default;
+        };
+
+        /**
+         * Design the biquad described by spec with the given FilterDesign flavour
+         */
+        template <typename Design = FilterDesign>
+        BiquadCoefficients design_filter(const FilterSpec &spec)
+        {
+            switch (spec.type)
+            {
+            case FilterType::Lowpass:
+                return Design::lowpass(spec.sample_rate, spec.frequency, spec.shape);
+            case FilterType::Highpass:
+                return Design::highpass(spec.sample_rate, spec.frequency, spec.shape);
+            case FilterType::Bandpass:
+                return Design::bandpass(spec.sample_rate, spec.frequency, spec.shape);
+            case FilterType::Notch:
+                return Design::notch(spec.sample_rate, spec.frequency, spec.shape);
+            case FilterType::PeakingEQ:
+                return Design::peaking_eq(spec.sample_rate, spec.frequency, spec.gain_db, spec.shape);
+            case FilterType::LowShelf:
+                return Design::low_shelf(spec.sample_rate, spec.frequency, spec.gain_db, spec.shape);
+            case FilterType::HighShelf:
+                return Design::high_shelf(spec.sample_rate, spec.frequency, spec.gain_db, spec.shape);
+            case FilterType::Allpass:
+                return Design::allpass(spec.sample_rate, spec.frequency, spec.shape);
+            }
+            throw std::invalid_argument("Unknown filter type");
+        }
+
+        /**
+         * Bounded memo of designed coefficients, least recently used evicted
+         *
+         * Preset loads and multi-channel setups request the same designs over
+         * and over; a hit costs one hash lookup instead of the trig. Keys
+         * compare parameters exactly, with gain_db zeroed for the shapes
+         * that ignore it. Thread-safe; shared() is a process-wide instance
+         * used when effects are built and EQ bands added. Parameter setters
+         * design directly: automation sweeps would only take the lock and
+         * evict useful entries with one-off keys.
+         */
+        template <typename Design = FilterDesign>
+        class BasicCoefficientCache
+        {
+        public:
+            static constexpr size_t default_capacity = 4096;
+
+            explicit BasicCoefficientCache(size_t capacity = default_capacity)
+                : capacity_(capacity)
+            {
+                if (capacity == 0)
+                {
+                    throw std::invalid_argument("Cache capacity must be positive");
+                }
+            }
+
+            /**
+             * Coefficients for spec, designed on a miss
+             * Invalid specs throw like FilterDesign and are not cached;
+             * so do non-finite fields, which could never match a key.
+             */
+            BiquadCoefficients get(const FilterSpec &spec)
+            {
+                const FilterSpec key = make_key(spec);
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                auto found = index_.find(key);
+                if (found != index_.end())
+                {
+                    ++hits_;
+                    entries_.splice(entries_.begin(), entries_, found->second);
+                    return found->second->second;
+                }
+
+                ++misses_;
+                BiquadCoefficients coeffs = design_filter<Design>(key);
+
+                if (entries_.size() >= capacity_)
+                {
+                    index_.erase(entries_.back().first);
+                    entries_.pop_back();
+                }
+                entries_.emplace_front(key, coeffs);
+                index_.emplace(key, entries_.begin());
+                return coeffs;
+            }
+
+            void clear()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                entries_.clear();
+                index_.clear();
+                hits_ = misses_ = 0;
+            }
+
+            size_t size() const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return entries_.size();
+            }
+
+            size_t capacity() const { return capacity_; }
+
+            size_t hits() const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return hits_;
+            }
+
+            size_t misses() const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return misses_;
+            }
+
+            /// Process-wide cache
+            static BasicCoefficientCache &shared()
+            {
+                static BasicCoefficientCache cache;
+                return cache;
+            }
+
+        private:
+            // Validated spec with unused fields normalised
+            static FilterSpec make_key(const FilterSpec &spec)
+            {
+                for (double value : {spec.sample_rate, spec.frequency, spec.shape, spec.gain_db})
+                {
+                    if (!std::isfinite(value))
+                    {
+                        throw std::invalid_argument("Filter spec parameters must be finite");
+                    }
+                }
+
+                FilterSpec key = spec;
+                switch (spec.type)
+                {
+                case FilterType::PeakingEQ:
+                case FilterType::LowShelf:
+                case FilterType::HighShelf:
+                    break;
+                default:
+                    key.gain_db = 0.0;
+                    break;
+                }
+                return key;
+            }
+
+            struct SpecHash
+            {
+                size_t operator()(const FilterSpec &spec) const
+                {
+                    size_t h = std::hash<int>{}(static_cast<int>(spec.type));
+                    for (double value : {spec.sample_rate, spec.frequency, spec.shape, spec.gain_db})
+                    {
+                        h ^= std::hash<double>{}(value) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                    }
+                    return h;
+                }
+            };
+
+            using Entry = std::pair<FilterSpec, BiquadCoefficients>;
+
+            size_t capacity_;
+            size_t hits_ = 0;
+            size_t misses_ = 0;
+            std::list<Entry> entries_; // Most recently used first
+            std::unordered_map<FilterSpec, typename std::list<Entry>::iterator, SpecHash> index_;
+            mutable std::mutex mutex_;
+        };
+
+        using CoefficientCache = BasicCoefficientCache<FilterDesign>;
+        using FastCoefficientCache = BasicCoefficientCache<FastFilterDesign>;
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "project.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define AUDIO_HAS_MXCSR 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define AUDIO_HAS_FPCR 1
+#endif
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Scoped flush-to-zero / denormals-are-zero guard
+         *
+         * Decaying IIR state eventually becomes denormal, and denormal
+         * arithmetic is 10-100x slower on most CPUs. While a guard is alive the
+         * current thread treats denormal inputs and results as zero; the
+         * previous floating-point mode is restored on destruction.
+         *
+         * x86: MXCSR FTZ (bit 15) + DAZ (bit 6); AArch64: FPCR FZ (bit 24).
+         * Elsewhere is_supported() is false and the guard does nothing.
+         *
+         * Reading and writing the control register costs tens of cycles,
+         * so hold one per block at the entry points (effects, cascades,
+         * the host loop), not inside each filter. Recursive filters also
+         * pass their feedback terms through flush_denormal() every sample,
+         * so they stay denormal-free when nobody holds a guard.
+         */
+        class ScopedNoDenormals
+        {
+        public:
+            ScopedNoDenormals() noexcept
+            {
+#if defined(AUDIO_HAS_MXCSR)
+                previous_ = _mm_getcsr();
+                _mm_setcsr(previous_ | 0x8040u);
+#elif defined(AUDIO_HAS_FPCR) && (defined(__GNUC__) || defined(__clang__))
+                uint64_t fpcr;
+                __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+                previous_ = fpcr;
+                fpcr |= (1ull << 24);
+                __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#endif
+            }
+
+            ~ScopedNoDenormals()
+            {
+#if defined(AUDIO_HAS_MXCSR)
+                _mm_setcsr(static_cast<unsigned int>(previous_));
+#elif defined(AUDIO_HAS_FPCR) && (defined(__GNUC__) || defined(__clang__))
+                uint64_t fpcr = previous_;
+                __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#endif
+            }
+
+            ScopedNoDenormals(const ScopedNoDenormals &) = delete;
+            ScopedNoDenormals &operator=(const ScopedNoDenormals &) = delete;
+
+            /// True if the guard actually changes the hardware mode on this target
+            static constexpr bool is_supported() noexcept
+            {
+#if defined(AUDIO_HAS_MXCSR) || (defined(AUDIO_HAS_FPCR) && (defined(__GNUC__) || defined(__clang__)))
+                return true;
+#else
+                return false;
+#endif
+            }
+
+        private:
+            [[maybe_unused]] uint64_t previous_ = 0;
+        };
+
+        /**
+         * Software anti-denormal for feedback terms
+         * Snaps values too small to matter (below ~-400 dBFS for double,
+         * ~-300 dBFS for float) to zero before they become denormal. Values
+         * above the threshold are untouched, so decay cannot get stuck in a
+         * limit cycle, and the compare-and-select vectorises with the filter.
+         */
+        template <typename T>
+        inline T flush_denormal(T value) noexcept
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                constexpr T threshold = std::is_same_v<T, float> ? T(1e-15) : T(1e-20);
+                return std::abs(value) < threshold ? T(0) : value;
+            }
+            else
+            {
+                return value;
+            }
+        }
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,611 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/FilterDesign.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+#include <complex>
+#include <mutex>
+#include <unordered_map>
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Mixed-radix fast Fourier transform
+         *
+         * Sizes factor into radix-4, 2, 3 and 5 stages with dedicated
+         * butterflies; other prime factors up to max_radix use a generic
+         * butterfly. Stages run decimation in time after a precomputed
+         * digit-reversal permutation. Butterflies are written as plain real
+         * arithmetic over contiguous indices so the compiler can vectorise
+         * them for the target (see ENABLE_NATIVE_ARCH).
+         *
+         * Twiddles and permutations are computed once per object; transforms
+         * are const and may run concurrently. plan() returns a shared,
+         * cached instance per size. Forward transforms are unscaled, inverse
+         * ones scale by 1/N, so inverse(forward(x)) == x.
+         *
+         * Real transforms (even sizes) pack the N real samples into an
+         * N/2-point complex transform and split the result, producing the
+         * N/2 + 1 non-redundant bins (DC .. Nyquist). For even sizes only
+         * that half-size plan is built up front; the N-point complex plan
+         * is built on the first forward() / inverse() call, so real-only
+         * users (FIRFilter, FIRDesign) never pay for it.
+         */
+        template <typename Real>
+        class FFT
+        {
+        public:
+            using Complex = std::complex<Real>;
+
+            /// Largest prime factor a size may contain
+            static constexpr size_t max_radix = 64;
+
+            explicit FFT(size_t size)
+                : size_(size)
+            {
+                if (size % 2 != 0)
+                {
+                    full_ = std::make_unique<Plan>(size); // Complex transforms only
+                }
+                else
+                {
+                    half_ = std::make_unique<Plan>(size / 2); // Also validates size
+
+                    real_twiddles_.resize(size / 4 + 1);
+                    for (size_t k = 0; k < real_twiddles_.size(); ++k)
+                    {
+                        real_twiddles_[k] = unit_root(k, size);
+                    }
+                }
+            }
+
+            /**
+             * Shared transform for size, built on first use
+             * Thread-safe. The cache keeps one plan per distinct size ever
+             * requested and is never trimmed on its own: entries live until
+             * clear_plan_cache() (callers holding a plan keep it alive past
+             * that). Long-running hosts that sweep many sizes should clear
+             * it when those sizes go out of use.
+             */
+            static std::shared_ptr<const FFT> plan(size_t size)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(cache_mutex());
+                    auto found = cache().find(size);
+                    if (found != cache().end())
+                    {
+                        return found->second;
+                    }
+                }
+
+                // Build outside the lock; if another thread won the race use its plan
+                auto created = std::make_shared<const FFT>(size);
+                std::lock_guard<std::mutex> lock(cache_mutex());
+                return cache().emplace(size, std::move(created)).first->second;
+            }
+
+            static void clear_plan_cache()
+            {
+                std::lock_guard<std::mutex> lock(cache_mutex());
+                cache().clear();
+            }
+
+            size_t size() const { return size_; }
+
+            /// Number of bins produced by forward_real()
+            size_t num_bins() const { return size_ / 2 + 1; }
+
+            /// In-place complex transform of size() points
+            void forward(Complex *data) const
+            {
+                complex_plan().template run<false>(data);
+            }
+
+            /// In-place inverse complex transform, scaled by 1/N
+            void inverse(Complex *data) const
+            {
+                complex_plan().template run<true>(data);
+                scale(data, size_);
+            }
+
+            /**
+             * Real-input transform (even sizes)
+             * @param in  size() real samples
+             * @param out num_bins() complex bins (also used as work space)
+             */
+            void forward_real(const Real *in, Complex *out) const
+            {
+                require_real();
+                const size_t half = size_ / 2;
+
+                // Even samples as real part, odd samples as imaginary part
+                for (size_t n = 0; n < half; ++n)
+                {
+                    out[n] = Complex(in[2 * n], in[2 * n + 1]);
+                }
+                half_->template run<false>(out);
+
+                const Complex z0 = out[0];
+                out[0] = Complex(z0.real() + z0.imag(), Real(0));
+                out[half] = Complex(z0.real() - z0.imag(), Real(0));
+
+                for (size_t k = 1; k <= half / 2; ++k)
+                {
+                    const Complex a = out[k];
+                    const Complex b = out[half - k];
+
+                    // Even / odd sub-spectra
+                    const Complex even = Real(0.5) * (a + std::conj(b));
+                    const Complex diff = a - std::conj(b);
+                    const Complex odd(Real(0.5) * diff.imag(), Real(-0.5) * diff.real());
+                    const Complex rotated = multiply(real_twiddles_[k], odd);
+
+                    out[k] = even + rotated;
+                    out[half - k] = std::conj(even - rotated);
+                }
+            }
+
+            /**
+             * Inverse of forward_real(), scaled by 1/N
+             * @param in   num_bins() complex bins
+             * @param out  size() real samples
+             * @param work size() / 2 complex values of scratch
+             */
+            void inverse_real(const Complex *in, Real *out, Complex *work) const
+            {
+                require_real();
+                const size_t half = size_ / 2;
+
+                const Real dc = in[0].real();
+                const Real nyquist = in[half].real();
+                work[0] = Complex(Real(0.5) * (dc + nyquist), Real(0.5) * (dc - nyquist));
+
+                for (size_t k = 1; k <= half / 2; ++k)
+                {
+                    const Complex a = in[k];
+                    const Complex b = std::conj(in[half - k]);
+
+                    const Complex even = Real(0.5) * (a + b);
+                    const Complex odd = multiply(Real(0.5) * (a - b), std::conj(real_twiddles_[k]));
+
+                    // Packed spectrum Z = E + iO, and its mirror conj(E) + i conj(O)
+                    work[k] = even + Complex(-odd.imag(), odd.real());
+                    work[half - k] = std::conj(even) + Complex(odd.imag(), odd.real());
+                }
+
+                half_->template run<true>(work);
+
+                // Unpack even / odd samples and apply the 1/N scaling in one pass
+                const Real inv = Real(1) / static_cast<Real>(half);
+                for (size_t n = 0; n < half; ++n)
+                {
+                    out[2 * n] = work[n].real() * inv;
+                    out[2 * n + 1] = work[n].imag() * inv;
+                }
+            }
+
+            /**
+             * inverse_real() with per-thread scratch
+             * Allocates on a thread's first call at a new largest size; use
+             * the overload above on real-time threads.
+             */
+            void inverse_real(const Complex *in, Real *out) const
+            {
+                thread_local std::vector<Complex> work;
+                if (work.size() < size_ / 2)
+                {
+                    work.resize(size_ / 2);
+                }
+                inverse_real(in, out, work.data());
+            }
+
+        private:
+            static Complex unit_root(size_t k, size_t n)
+            {
+                const double angle = -TWO_PI * static_cast<double>(k) / static_cast<double>(n);
+                return Complex(static_cast<Real>(std::cos(angle)), static_cast<Real>(std::sin(angle)));
+            }
+
+            // Plain complex product (std::complex operator* adds NaN recovery)
+            static Complex multiply(const Complex &a, const Complex &b)
+            {
+                return Complex(a.real() * b.real() - a.imag() * b.imag(),
+                               a.real() * b.imag() + a.imag() * b.real());
+            }
+
+            // Multiply by -i (forward) or +i (inverse)
+            template <bool Inverse>
+            static Complex rotate(const Complex &a)
+            {
+                if constexpr (Inverse)
+                {
+                    return Complex(-a.imag(), a.real());
+                }
+                else
+                {
+                    return Complex(a.imag(), -a.real());
+                }
+            }
+
+            static void scale(Complex *data, size_t n)
+            {
+                const Real inv = Real(1) / static_cast<Real>(n);
+
+                AUDIO_SIMD_LOOP
+                for (size_t i = 0; i < n; ++i)
+                {
+                    data[i] = Complex(data[i].real() * inv, data[i].imag() * inv);
+                }
+            }
+
+            void require_real() const
+            {
+                if (!half_)
+                {
+                    throw std::logic_error("Real FFT needs an even size");
+                }
+            }
+
+            /**
+             * Factorisation, permutation and twiddles for one complex size
+             */
+            class Plan
+            {
+            public:
+                explicit Plan(size_t n)
+                    : n_(n)
+                {
+                    if (n == 0)
+                    {
+                        throw std::invalid_argument("FFT size must be positive");
+                    }
+
+                    factorise(n);
+
+                    twiddles_.resize(n);
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        twiddles_[k] = unit_root(k, n);
+                    }
+
+                    build_permutation();
+                    build_stage_twiddles();
+                }
+
+                template <bool Inverse>
+                void run(Complex *data) const
+                {
+                    permute(data);
+
+                    size_t span = 1; // Length of the sub-transforms being combined
+                    for (size_t s = 0; s < factors_.size(); ++s)
+                    {
+                        const size_t radix = factors_[s];
+                        const Complex *tw = stage_twiddles_.data() + stage_offsets_[s];
+                        switch (radix)
+                        {
+                        case 2:
+                            stage2<Inverse>(data, span, tw);
+                            break;
+                        case 3:
+                            stage3<Inverse>(data, span, tw);
+                            break;
+                        case 4:
+                            stage4<Inverse>(data, span, tw);
+                            break;
+                        case 5:
+                            stage5<Inverse>(data, span, tw);
+                            break;
+                        default:
+                            stage_generic<Inverse>(data, radix, span, tw);
+                            break;
+                        }
+                        span *= radix;
+                    }
+                }
+
+            private:
+                void factorise(size_t n)
+                {
+                    // Generic primes first (short spans), radix-4 last (most work)
+                    std::vector<size_t> fours, small;
+                    while (n % 4 == 0)
+                    {
+                        fours.push_back(4);
+                        n /= 4;
+                    }
+                    for (size_t p : {2, 3, 5})
+                    {
+                        while (n % p == 0)
+                        {
+                            small.push_back(p);
+                            n /= p;
+                        }
+                    }
+                    for (size_t p = 7; n > 1; p += 2)
+                    {
+                        if (p > max_radix)
+                        {
+                            throw std::invalid_argument("FFT size has a prime factor above " + std::to_string(max_radix));
+                        }
+                        while (n % p == 0)
+                        {
+                            factors_.push_back(p);
+                            n /= p;
+                        }
+                    }
+                    factors_.insert(factors_.end(), small.rbegin(), small.rend());
+                    factors_.insert(factors_.end(), fours.begin(), fours.end());
+                }
+
+                /**
+                 * Digit reversal for the stage order, stored as cycles so it
+                 * can be applied in place
+                 */
+                void build_permutation()
+                {
+                    std::vector<size_t> perm{0};
+                    for (size_t radix : factors_)
+                    {
+                        std::vector<size_t> next(perm.size() * radix);
+                        for (size_t j = 0; j < radix; ++j)
+                        {
+                            for (size_t t = 0; t < perm.size(); ++t)
+                            {
+                                next[j * perm.size() + t] = j + radix * perm[t];
+                            }
+                        }
+                        perm = std::move(next);
+                    }
+
+                    std::vector<bool> visited(n_, false);
+                    for (size_t start = 0; start < n_; ++start)
+                    {
+                        if (visited[start] || perm[start] == start)
+                            continue;
+
+                        cycle_starts_.push_back(cycles_.size());
+                        for (size_t i = start; !visited[i]; i = perm[i])
+                        {
+                            visited[i] = true;
+                            cycles_.push_back(static_cast<uint32_t>(i));
+                        }
+                    }
+                    cycle_starts_.push_back(cycles_.size());
+                }
+
+                /**
+                 * Per-stage twiddles W^(j k stride), one contiguous row per
+                 * butterfly input j >= 1, so stages read them with unit stride
+                 */
+                void build_stage_twiddles()
+                {
+                    size_t span = 1;
+                    for (size_t radix : factors_)
+                    {
+                        const size_t stride = n_ / (span * radix);
+                        stage_offsets_.push_back(stage_twiddles_.size());
+                        for (size_t j = 1; j < radix; ++j)
+                        {
+                            for (size_t k = 0; k < span; ++k)
+                            {
+                                stage_twiddles_.push_back(twiddles_[(j * k * stride) % n_]);
+                            }
+                        }
+                        span *= radix;
+                    }
+                }
+
+                // data[i] <- data[perm[i]] along each cycle
+                void permute(Complex *data) const
+                {
+                    for (size_t c = 0; c + 1 < cycle_starts_.size(); ++c)
+                    {
+                        const uint32_t *cycle = cycles_.data() + cycle_starts_[c];
+                        const size_t length = cycle_starts_[c + 1] - cycle_starts_[c];
+
+                        const Complex first = data[cycle[0]];
+                        for (size_t i = 0; i + 1 < length; ++i)
+                        {
+                            data[cycle[i]] = data[cycle[i + 1]];
+                        }
+                        data[cycle[length - 1]] = first;
+                    }
+                }
+
+                template <bool Inverse>
+                static Complex twiddle(const Complex &w)
+                {
+                    return Inverse ? std::conj(w) : w;
+                }
+
+                template <bool Inverse>
+                void stage2(Complex *data, size_t span, const Complex *tw) const
+                {
+                    for (size_t start = 0; start < n_; start += 2 * span)
+                    {
+                        Complex *AUDIO_RESTRICT x0 = data + start;
+                        Complex *AUDIO_RESTRICT x1 = x0 + span;
+
+                        for (size_t k = 0; k < span; ++k)
+                        {
+                            const Complex a0 = x0[k];
+                            const Complex a1 = multiply(twiddle<Inverse>(tw[k]), x1[k]);
+                            x0[k] = a0 + a1;
+                            x1[k] = a0 - a1;
+                        }
+                    }
+                }
+
+                template <bool Inverse>
+                void stage3(Complex *data, size_t span, const Complex *tw) const
+                {
+                    // sin(2 pi / 3), sign follows the transform direction
+                    constexpr Real s = Real(0.86602540378443864676);
+
+                    for (size_t start = 0; start < n_; start += 3 * span)
+                    {
+                        Complex *AUDIO_RESTRICT x0 = data + start;
+                        Complex *AUDIO_RESTRICT x1 = x0 + span;
+                        Complex *AUDIO_RESTRICT x2 = x1 + span;
+
+                        for (size_t k = 0; k < span; ++k)
+                        {
+                            const Complex a0 = x0[k];
+                            const Complex a1 = multiply(twiddle<Inverse>(tw[k]), x1[k]);
+                            const Complex a2 = multiply(twiddle<Inverse>(tw[1 * span + k]), x2[k]);
+
+                            const Complex sum = a1 + a2;
+                            const Complex mid = a0 - Real(0.5) * sum;
+                            const Complex rot = rotate<Inverse>(s * (a1 - a2));
+
+                            x0[k] = a0 + sum;
+                            x1[k] = mid + rot;
+                            x2[k] = mid - rot;
+                        }
+                    }
+                }
+
+                template <bool Inverse>
+                void stage4(Complex *data, size_t span, const Complex *tw) const
+                {
+                    for (size_t start = 0; start < n_; start += 4 * span)
+                    {
+                        Complex *AUDIO_RESTRICT x0 = data + start;
+                        Complex *AUDIO_RESTRICT x1 = x0 + span;
+                        Complex *AUDIO_RESTRICT x2 = x1 + span;
+                        Complex *AUDIO_RESTRICT x3 = x2 + span;
+
+                        for (size_t k = 0; k < span; ++k)
+                        {
+                            const Complex a0 = x0[k];
+                            const Complex a1 = multiply(twiddle<Inverse>(tw[k]), x1[k]);
+                            const Complex a2 = multiply(twiddle<Inverse>(tw[1 * span + k]), x2[k]);
+                            const Complex a3 = multiply(twiddle<Inverse>(tw[2 * span + k]), x3[k]);
+
+                            const Complex t0 = a0 + a2;
+                            const Complex t1 = a0 - a2;
+                            const Complex t2 = a1 + a3;
+                            const Complex t3 = rotate<Inverse>(a1 - a3);
+
+                            x0[k] = t0 + t2;
+                            x1[k] = t1 + t3;
+                            x2[k] = t0 - t2;
+                            x3[k] = t1 - t3;
+                        }
+                    }
+                }
+
+                template <bool Inverse>
+                void stage5(Complex *data, size_t span, const Complex *tw) const
+                {
+                    constexpr Real c1 = Real(0.30901699437494742410);  // cos(2 pi / 5)
+                    constexpr Real c2 = Real(-0.80901699437494742410); // cos(4 pi / 5)
+                    constexpr Real s1 = Real(0.95105651629515357212);  // sin(2 pi / 5)
+                    constexpr Real s2 = Real(0.58778525229247312917);  // sin(4 pi / 5)
+
+                    for (size_t start = 0; start < n_; start += 5 * span)
+                    {
+                        Complex *x = data + start;
+
+                        for (size_t k = 0; k < span; ++k)
+                        {
+                            const Complex a0 = x[k];
+                            const Complex a1 = multiply(twiddle<Inverse>(tw[k]), x[k + span]);
+                            const Complex a2 = multiply(twiddle<Inverse>(tw[1 * span + k]), x[k + 2 * span]);
+                            const Complex a3 = multiply(twiddle<Inverse>(tw[2 * span + k]), x[k + 3 * span]);
+                            const Complex a4 = multiply(twiddle<Inverse>(tw[3 * span + k]), x[k + 4 * span]);
+
+                            const Complex b1 = a1 + a4, b2 = a2 + a3;
+                            const Complex d1 = a1 - a4, d2 = a2 - a3;
+
+                            const Complex m1 = a0 + c1 * b1 + c2 * b2;
+                            const Complex m2 = a0 + c2 * b1 + c1 * b2;
+                            const Complex n1 = rotate<Inverse>(s1 * d1 + s2 * d2);
+                            const Complex n2 = rotate<Inverse>(s2 * d1 - s1 * d2);
+
+                            x[k] = a0 + b1 + b2;
+                            x[k + span] = m1 + n1;
+                            x[k + 4 * span] = m1 - n1;
+                            x[k + 2 * span] = m2 + n2;
+                            x[k + 3 * span] = m2 - n2;
+                        }
+                    }
+                }
+
+                // Any prime radix, O(radix^2) per butterfly
+                template <bool Inverse>
+                void stage_generic(Complex *data, size_t radix, size_t span, const Complex *tw) const
+                {
+                    const size_t root_step = n_ / radix; // W_radix in the size-n table
+                    Complex in[max_radix];
+
+                    for (size_t start = 0; start < n_; start += radix * span)
+                    {
+                        Complex *x = data + start;
+
+                        for (size_t k = 0; k < span; ++k)
+                        {
+                            for (size_t j = 0; j < radix; ++j)
+                            {
+                                in[j] = j == 0 ? x[k] : multiply(twiddle<Inverse>(tw[(j - 1) * span + k]), x[k + j * span]);
+                            }
+                            for (size_t q = 0; q < radix; ++q)
+                            {
+                                Complex sum = in[0];
+                                for (size_t j = 1; j < radix; ++j)
+                                {
+                                    sum += multiply(twiddle<Inverse>(twiddles_[((j * q) % radix) * root_step]), in[j]);
+                                }
+                                x[k + q * span] = sum;
+                            }
+                        }
+                    }
+                }
+
+                size_t n_;
+                std::vector<size_t> factors_; // Radix of each stage, in execution order
+                std::vector<Complex> twiddles_; // exp(-2 pi i k / n), k < n
+                std::vector<Complex> stage_twiddles_;
+                std::vector<size_t> stage_offsets_;
+                std::vector<uint32_t> cycles_;
+                std::vector<size_t> cycle_starts_;
+            };
+
+            // N-point plan; even sizes build it on first complex use
+            const Plan &complex_plan() const
+            {
+                std::call_once(full_once_, [this]
+                               {
+                                   if (!full_)
+                                   {
+                                       full_ = std::make_unique<Plan>(size_);
+                                   } });
+                return *full_;
+            }
+
+            static std::unordered_map<size_t, std::shared_ptr<const FFT>> &cache()
+            {
+                static std::unordered_map<size_t, std::shared_ptr<const FFT>> plans;
+                return plans;
+            }
+
+            static std::mutex &cache_mutex()
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            size_t size_;
+            mutable std::unique_ptr<Plan> full_; // Complex plan, see complex_plan()
+            mutable std::once_flag full_once_;
+            std::unique_ptr<Plan> half_;         // Complex plan behind the real transforms
+            std::vector<Complex> real_twiddles_; // exp(-2 pi i k / N), k <= N/4
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/FilterDesign.hpp"
+#include "DSP/FFT.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Linear-phase FIR design (Kaiser-windowed sinc)
+         * Symmetric responses delay every frequency by (num_taps - 1) / 2
+         * samples; odd tap counts keep that delay whole.
+         */
+        class FIRDesign
+        {
+        public:
+            /**
+             * Low-pass filter
+             *
+             * @param sample_rate Sample rate in Hz
+             * @param cutoff_freq Cutoff frequency in Hz (-6dB point)
+             * @param num_taps Filter length
+             * @param beta Kaiser shape: ~5 for 50 dB, ~8 for 80 dB, ~10 for 100 dB stopband
+             */
+            static std::vector<double> lowpass(double sample_rate, double cutoff_freq, size_t num_taps, double beta = 8.0)
+            {
+                validate(sample_rate, cutoff_freq, num_taps);
+
+                const double fc = cutoff_freq / sample_rate;
+                const double centre = (static_cast<double>(num_taps) - 1.0) / 2.0;
+                const std::vector<double> window = kaiser_window(num_taps, beta);
+
+                std::vector<double> taps(num_taps);
+                double sum = 0.0;
+                for (size_t n = 0; n < num_taps; ++n)
+                {
+                    const double t = static_cast<double>(n) - centre;
+                    const double sinc = t == 0.0 ? 2.0 * fc : std::sin(TWO_PI * fc * t) / (PI * t);
+                    taps[n] = sinc * window[n];
+                    sum += taps[n];
+                }
+
+                // Unity gain at DC
+                for (auto &tap : taps)
+                {
+                    tap /= sum;
+                }
+                return taps;
+            }
+
+            /**
+             * High-pass filter (spectral inversion of the low-pass)
+             * @param num_taps Filter length, must be odd
+             */
+            static std::vector<double> highpass(double sample_rate, double cutoff_freq, size_t num_taps, double beta = 8.0)
+            {
+                if (num_taps % 2 == 0)
+                {
+                    throw std::invalid_argument("High-pass FIR needs an odd number of taps");
+                }
+
+                std::vector<double> taps = lowpass(sample_rate, cutoff_freq, num_taps, beta);
+                for (auto &tap : taps)
+                {
+                    tap = -tap;
+                }
+                taps[num_taps / 2] += 1.0;
+                return taps;
+            }
+
+            /**
+             * Arbitrary magnitude response (frequency sampling)
+             *
+             * The magnitude is taken as a zero-phase spectrum, transformed
+             * back to an impulse response, centred and Kaiser-windowed, so
+             * the result is linear phase with the requested magnitude
+             * smoothed by the window's main lobe.
+             *
+             * @param magnitude Linear gain at N/2 + 1 evenly spaced bins from
+             *                  DC to Nyquist (N even, N >= num_taps)
+             * @param num_taps Filter length, must be odd
+             * @param beta Kaiser shape; lower values resolve narrower features
+             */
+            static std::vector<double> from_magnitude(std::span<const double> magnitude, size_t num_taps, double beta = 6.0)
+            {
+                if (num_taps % 2 == 0)
+                {
+                    throw std::invalid_argument("Frequency-sampled FIR needs an odd number of taps");
+                }
+                if (magnitude.size() < 2 || 2 * (magnitude.size() - 1) < num_taps)
+                {
+                    throw std::invalid_argument("Magnitude grid is too coarse for the filter length");
+                }
+
+                const size_t fft_size = 2 * (magnitude.size() - 1);
+                const auto fft = FFT<double>::plan(fft_size);
+
+                std::vector<std::complex<double>> spectrum(magnitude.begin(), magnitude.end());
+                std::vector<double> impulse(fft_size);
+                fft->inverse_real(spectrum.data(), impulse.data());
+
+                // Zero-phase response wraps around index 0; shift its centre to num_taps / 2
+                const size_t centre = num_taps / 2;
+                const std::vector<double> window = kaiser_window(num_taps, beta);
+                std::vector<double> taps(num_taps);
+                for (size_t n = 0; n < num_taps; ++n)
+                {
+                    taps[n] = impulse[(n + fft_size - centre) % fft_size] * window[n];
+                }
+                return taps;
+            }
+
+            /**
+             * Kaiser window of the given length
+             * w[n] = I0(beta * sqrt(1 - r^2)) / I0(beta), r from -1 to 1
+             */
+            static std::vector<double> kaiser_window(size_t length, double beta)
+            {
+                std::vector<double> window(length, 1.0);
+                if (length < 2)
+                {
+                    return window;
+                }
+
+                const double denom = bessel_i0(beta);
+                const double centre = (static_cast<double>(length) - 1.0) / 2.0;
+                for (size_t n = 0; n < length; ++n)
+                {
+                    const double r = (static_cast<double>(n) - centre) / centre;
+                    window[n] = bessel_i0(beta * std::sqrt(std::max(0.0, 1.0 - r * r))) / denom;
+                }
+                return window;
+            }
+
+            // Modified Bessel function of the first kind, order 0 (power series)
+            static double bessel_i0(double x)
+            {
+                const double q = x * x / 4.0;
+                double term = 1.0;
+                double sum = 1.0;
+                for (int k = 1; k < 64 && term > sum * 1e-17; ++k)
+                {
+                    term *= q / (static_cast<double>(k) * static_cast<double>(k));
+                    sum += term;
+                }
+                return sum;
+            }
+
+        private:
+            static void validate(double sample_rate, double freq, size_t num_taps)
+            {
+                if (freq <= 0.0 || freq >= sample_rate / 2.0)
+                {
+                    throw std::invalid_argument(
+                        "Frequency must be between 0 and Nyquist frequency (" + std::to_string(sample_rate / 2.0) + " Hz)");
+                }
+                if (num_taps == 0)
+                {
+                    throw std::invalid_argument("FIR filter needs at least one tap");
+                }
+            }
+        };
+
+    } // namespace dsp
+} // namespace audio
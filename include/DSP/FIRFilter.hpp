@@ -0,0 +1,322 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/FFT.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Streaming FIR filter for interleaved buffers
+         *
+         * Short filters (up to direct_max_taps) run a direct-form kernel
+         * whose inner loop walks the output block for one tap at a time, so
+         * it vectorises across samples. Longer filters split the response:
+         * the first block_size() taps still run direct (zero latency), the
+         * rest go through uniformly partitioned FFT overlap-save convolution
+         * with a frequency-domain delay line. Per sample that costs O(B) for
+         * the direct head plus O(log B + P) for the partitions (B =
+         * block_size(), P = partition count), O(B + log B + P) in all,
+         * instead of O(N). Output equals direct convolution either way and
+         * any block length may be passed to process_buffer().
+         */
+        template <typename SampleType>
+        class FIRFilter
+        {
+        public:
+            using value_type = simd::compute_t<SampleType>;
+            using Complex = std::complex<value_type>;
+
+            /// Longest filter run entirely in direct form
+            static constexpr size_t direct_max_taps = 128;
+
+            FIRFilter()
+            {
+                const double identity = 1.0;
+                set_taps(std::span<const double>(&identity, 1));
+            }
+
+            /**
+             * @param taps Impulse response
+             * @param block_size Partition size for long filters (power of two),
+             *                   0 picks one from the tap count
+             */
+            explicit FIRFilter(std::span<const double> taps, size_t block_size = 0)
+            {
+                set_taps(taps, block_size);
+            }
+
+            /// Replace the impulse response (clears the filter state)
+            void set_taps(std::span<const double> taps, size_t block_size = 0)
+            {
+                if (taps.empty())
+                {
+                    throw std::invalid_argument("FIR filter needs at least one tap");
+                }
+                if (block_size != 0 && (block_size < 16 || (block_size & (block_size - 1)) != 0))
+                {
+                    throw std::invalid_argument("FIR block size must be a power of two >= 16");
+                }
+
+                num_taps_ = taps.size();
+                const bool partitioned = num_taps_ > direct_max_taps;
+
+                if (!partitioned)
+                {
+                    block_size_ = 256; // Chunk length for the direct kernel only
+                    head_taps_ = num_taps_;
+                }
+                else
+                {
+                    block_size_ = block_size != 0 ? block_size : auto_block_size(num_taps_);
+                    head_taps_ = std::min(num_taps_, block_size_);
+                }
+
+                // Reversed head so the kernel reads history forwards
+                head_.resize(head_taps_);
+                for (size_t j = 0; j < head_taps_; ++j)
+                {
+                    head_[j] = static_cast<value_type>(taps[head_taps_ - 1 - j]);
+                }
+
+                partitions_.clear();
+                num_partitions_ = 0;
+                if (partitioned && num_taps_ > head_taps_)
+                {
+                    const size_t B = block_size_;
+                    fft_ = FFT<value_type>::plan(2 * B);
+                    num_partitions_ = (num_taps_ - head_taps_ + B - 1) / B;
+                    partitions_.resize(num_partitions_ * (B + 1));
+
+                    // Each partition zero-padded to 2B and transformed once
+                    std::vector<value_type> segment(2 * B);
+                    for (size_t p = 0; p < num_partitions_; ++p)
+                    {
+                        std::fill(segment.begin(), segment.end(), value_type(0));
+                        for (size_t j = 0; j < B; ++j)
+                        {
+                            const size_t tap = head_taps_ + p * B + j;
+                            if (tap < num_taps_)
+                            {
+                                segment[j] = static_cast<value_type>(taps[tap]);
+                            }
+                        }
+                        fft_->forward_real(segment.data(), partitions_.data() + p * (B + 1));
+                    }
+
+                    spectrum_.resize(B + 1);
+                    work_.resize(B);
+                    time_.resize(2 * B);
+                }
+                else
+                {
+                    fft_.reset();
+                }
+
+                channels_.clear();
+                chunk_.resize(block_size_);
+                position_ = 0;
+            }
+
+            // Allocate state for num_channels up front (processing then never allocates)
+            void prepare(size_t num_channels)
+            {
+                while (channels_.size() < num_channels)
+                {
+                    ChannelState state;
+                    state.history.assign(head_taps_ - 1 + block_size_, value_type(0));
+                    if (num_partitions_ > 0)
+                    {
+                        state.overlap.assign(2 * block_size_, value_type(0));
+                        state.tail.assign(block_size_, value_type(0));
+                        state.delay_line.assign(num_partitions_ * (block_size_ + 1), Complex(0));
+                    }
+                    channels_.push_back(std::move(state));
+                }
+            }
+
+            // Process entire buffer (interleaved stereo/mono)
+            void process_buffer(SampleType *buffer, size_t num_samples, size_t num_channels)
+            {
+                prepare(num_channels);
+
+                size_t done = 0;
+                while (done < num_samples)
+                {
+                    // Never cross a partition boundary inside one chunk
+                    const size_t count = std::min(num_samples - done, block_size_ - position_);
+
+                    for (size_t ch = 0; ch < num_channels; ++ch)
+                    {
+                        process_chunk(channels_[ch], buffer + done * num_channels + ch, count, num_channels);
+                    }
+
+                    if (num_partitions_ > 0)
+                    {
+                        position_ += count;
+                        if (position_ == block_size_)
+                        {
+                            for (size_t ch = 0; ch < num_channels; ++ch)
+                            {
+                                convolve_block(channels_[ch]);
+                            }
+                            position_ = 0;
+                        }
+                    }
+                    done += count;
+                }
+            }
+
+            // Reset filter state (clear history)
+            void reset()
+            {
+                for (auto &state : channels_)
+                {
+                    std::fill(state.history.begin(), state.history.end(), value_type(0));
+                    std::fill(state.overlap.begin(), state.overlap.end(), value_type(0));
+                    std::fill(state.tail.begin(), state.tail.end(), value_type(0));
+                    std::fill(state.delay_line.begin(), state.delay_line.end(), Complex(0));
+                    state.delay_head = 0;
+                }
+                position_ = 0;
+            }
+
+            size_t num_taps() const { return num_taps_; }
+
+            /// True if the filter uses FFT partitions beyond the direct head
+            bool is_partitioned() const { return num_partitions_ > 0; }
+
+            /// Partition length (chunk length for direct-only filters)
+            size_t block_size() const { return block_size_; }
+
+            size_t num_partitions() const { return num_partitions_; }
+
+        private:
+            struct ChannelState
+            {
+                std::vector<value_type> history;  // head_taps - 1 past inputs, then the current chunk
+                std::vector<value_type> overlap;  // Previous and current input block (2B)
+                std::vector<value_type> tail;     // Partitioned output for the current block
+                std::vector<Complex> delay_line;  // Input spectra, one per partition
+                size_t delay_head = 0;
+            };
+
+            // Partition size ~ sqrt(N) balances the direct head against the FFTs
+            static size_t auto_block_size(size_t num_taps)
+            {
+                size_t block = 64;
+                while (block * block < num_taps && block < 1024)
+                {
+                    block <<= 1;
+                }
+                return block;
+            }
+
+            void process_chunk(ChannelState &state, SampleType *samples, size_t count, size_t stride)
+            {
+                value_type *AUDIO_RESTRICT history = state.history.data();
+                value_type *AUDIO_RESTRICT out = chunk_.data();
+                const value_type *AUDIO_RESTRICT head = head_.data();
+                const size_t past = head_taps_ - 1;
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    history[past + i] = static_cast<value_type>(samples[i * stride]);
+                }
+
+                // Direct head: out[i] = sum_j head[j] * history[i + j]
+                std::fill(out, out + count, value_type(0));
+                for (size_t j = 0; j < head_taps_; ++j)
+                {
+                    const value_type h = head[j];
+                    const value_type *AUDIO_RESTRICT x = history + j;
+
+                    AUDIO_SIMD_LOOP
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        out[i] += h * x[i];
+                    }
+                }
+
+                if (num_partitions_ > 0)
+                {
+                    std::copy(history + past, history + past + count, state.overlap.data() + block_size_ + position_);
+
+                    const value_type *AUDIO_RESTRICT tail = state.tail.data() + position_;
+                    AUDIO_SIMD_LOOP
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        out[i] += tail[i];
+                    }
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    samples[i * stride] = simd::saturate_cast<SampleType>(out[i]);
+                }
+
+                std::copy(history + count, history + count + past, history);
+            }
+
+            /**
+             * Overlap-save step after a full input block
+             * Output of the partitioned taps for this block is played during
+             * the next one, which is exactly the delay the head taps cover.
+             */
+            void convolve_block(ChannelState &state)
+            {
+                const size_t B = block_size_;
+                const size_t bins = B + 1;
+
+                Complex *current = state.delay_line.data() + state.delay_head * bins;
+                fft_->forward_real(state.overlap.data(), current);
+
+                std::fill(spectrum_.begin(), spectrum_.end(), Complex(0));
+                value_type *AUDIO_RESTRICT acc = reinterpret_cast<value_type *>(spectrum_.data());
+
+                for (size_t p = 0; p < num_partitions_; ++p)
+                {
+                    const size_t slot = (state.delay_head + num_partitions_ - p) % num_partitions_;
+                    const value_type *AUDIO_RESTRICT x = reinterpret_cast<const value_type *>(state.delay_line.data() + slot * bins);
+                    const value_type *AUDIO_RESTRICT h = reinterpret_cast<const value_type *>(partitions_.data() + p * bins);
+
+                    for (size_t k = 0; k < bins; ++k)
+                    {
+                        const value_type xr = x[2 * k], xi = x[2 * k + 1];
+                        const value_type hr = h[2 * k], hi = h[2 * k + 1];
+                        acc[2 * k] += xr * hr - xi * hi;
+                        acc[2 * k + 1] += xr * hi + xi * hr;
+                    }
+                }
+
+                fft_->inverse_real(spectrum_.data(), time_.data(), work_.data());
+                std::copy(time_.begin() + B, time_.end(), state.tail.begin());
+
+                std::copy(state.overlap.begin() + B, state.overlap.end(), state.overlap.begin());
+                state.delay_head = (state.delay_head + 1) % num_partitions_;
+            }
+
+            size_t num_taps_ = 0;
+            size_t head_taps_ = 0;
+            size_t block_size_ = 0;
+            size_t num_partitions_ = 0;
+
+            std::vector<value_type> head_;  // Reversed first head_taps_ taps
+            std::vector<Complex> partitions_; // Spectra of the remaining taps, B + 1 bins each
+            std::shared_ptr<const FFT<value_type>> fft_; // Shared plan from the cache
+
+            std::vector<ChannelState> channels_;
+            size_t position_ = 0; // Samples into the current block
+
+            // Scratch shared by all channels
+            std::vector<value_type> chunk_;
+            std::vector<Complex> spectrum_;
+            std::vector<Complex> work_; // Inverse transform scratch, B values
+            std::vector<value_type> time_;
+        };
+
+    } // namespace dsp
+} // namespace audio
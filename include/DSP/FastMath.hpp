@@ -0,0 +1,188 @@
+#pragma once
+
+#include "project.h"
+
+#include <bit>
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Polynomial approximations, valid over the ranges filter design uses
+         *
+         * sin_cos: x in [0, pi] (0 < f < Nyquist), absolute error < 1e-11.
+         * tan:     x in [0, pi/2), relative error < 1e-9 below 0.49 * pi.
+         * exp:     |x| < 700, relative error < 1e-9.
+         * sinh:    relative error < 1e-9 (series below 0.5, exp above).
+         * pow10:   via exp, relative error < 1e-9.
+         * sqrt:    std::sqrt at run time, Newton iteration (exact to
+         *          rounding) in constant evaluation.
+         *
+         * Designed coefficients agree with StdMath to about 1e-8, far below
+         * anything audible, so this path suits sweeps and preset loads.
+         * Everything is constexpr, which is what lets the designers run at
+         * compile time.
+         */
+        struct FastMath
+        {
+            static constexpr void sin_cos(double x, double &s, double &c)
+            {
+                constexpr double half_pi = 1.57079632679489661923;
+                s = sin_half_period(half_pi - abs(x - half_pi));
+                c = sin_half_period(half_pi - x);
+            }
+
+            // tan for x in [0, pi/2): both halves from the sine polynomial
+            static constexpr double tan(double x)
+            {
+                constexpr double half_pi = 1.57079632679489661923;
+                return sin_half_period(x) / sin_half_period(half_pi - x);
+            }
+
+            static constexpr double exp(double x)
+            {
+                constexpr double log2e = 1.44269504088896340736;
+                constexpr double ln2 = 0.69314718055994530942;
+
+                // e^x = 2^k * e^r with |r| <= ln2 / 2
+                const double scaled = x * log2e;
+                const auto k = static_cast<int64_t>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+                const double r = x - static_cast<double>(k) * ln2;
+
+                // Taylor series to r^11: remainder < (ln2/2)^12 / 12! < 1e-14
+                double p = 1.0 / 39916800.0;
+                p = p * r + 1.0 / 3628800.0;
+                p = p * r + 1.0 / 362880.0;
+                p = p * r + 1.0 / 40320.0;
+                p = p * r + 1.0 / 5040.0;
+                p = p * r + 1.0 / 720.0;
+                p = p * r + 1.0 / 120.0;
+                p = p * r + 1.0 / 24.0;
+                p = p * r + 1.0 / 6.0;
+                p = p * r + 0.5;
+                p = p * r + 1.0;
+                p = p * r + 1.0;
+
+                // 2^k assembled from its exponent bits (normal range for |x| < 700)
+                return p * std::bit_cast<double>(static_cast<uint64_t>(k + 1023) << 52);
+            }
+
+            static constexpr double sinh(double x)
+            {
+                if (abs(x) < 0.5)
+                {
+                    // Odd series to x^9: remainder < 0.5^11 / 11! < 2e-11
+                    const double x2 = x * x;
+                    return x * (1.0 + x2 / 6.0 * (1.0 + x2 / 20.0 * (1.0 + x2 / 42.0 * (1.0 + x2 / 72.0))));
+                }
+                const double e = exp(x);
+                return 0.5 * (e - 1.0 / e);
+            }
+
+            static constexpr double pow10(double x)
+            {
+                constexpr double ln10 = 2.30258509299404568402;
+                return exp(x * ln10);
+            }
+
+            static constexpr double sqrt(double x)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return std::sqrt(x);
+                }
+                if (x <= 0.0)
+                {
+                    return 0.0;
+                }
+
+                // Scale into [0.25, 1) by powers of 4, then Newton from a linear guess
+                double scale = 1.0;
+                while (x >= 1.0)
+                {
+                    x *= 0.25;
+                    scale *= 2.0;
+                }
+                while (x < 0.25)
+                {
+                    x *= 4.0;
+                    scale *= 0.5;
+                }
+                double y = 0.5 + 0.5 * x;
+                for (int i = 0; i < 6; ++i)
+                {
+                    y = 0.5 * (y + x / y);
+                }
+                return y * scale;
+            }
+
+        private:
+            static constexpr double abs(double x) { return x < 0.0 ? -x : x; }
+
+            // sin(x) for |x| <= pi/2, Taylor series to x^15: remainder < 1e-11
+            static constexpr double sin_half_period(double x)
+            {
+                const double x2 = x * x;
+                double p = -1.0 / 1307674368000.0;
+                p = p * x2 + 1.0 / 6227020800.0;
+                p = p * x2 - 1.0 / 39916800.0;
+                p = p * x2 + 1.0 / 362880.0;
+                p = p * x2 - 1.0 / 5040.0;
+                p = p * x2 + 1.0 / 120.0;
+                p = p * x2 - 1.0 / 6.0;
+                p = p * x2 + 1.0;
+                return p * x;
+            }
+        };
+
+        /**
+         * Math policies for filter design
+         *
+         * FilterDesign needs sin/cos of the normalised frequency, sinh for the
+         * bandwidth term, sqrt for shelves and 10^x for dB gains; the
+         * state-variable filter needs tan of the prewarped cutoff. StdMath
+         * forwards to <cmath> at run time and falls back to the FastMath
+         * polynomials in constant evaluation, so FilterDesign results can
+         * be constexpr (compile-time coefficients differ from run-time ones
+         * by about 1e-8).
+         */
+        struct StdMath
+        {
+            static constexpr void sin_cos(double x, double &s, double &c)
+            {
+                if (std::is_constant_evaluated())
+                {
+                    FastMath::sin_cos(x, s, c);
+                    return;
+                }
+                s = std::sin(x);
+                c = std::cos(x);
+            }
+
+            static constexpr double tan(double x)
+            {
+                return std::is_constant_evaluated() ? FastMath::tan(x) : std::tan(x);
+            }
+
+            static constexpr double sinh(double x)
+            {
+                return std::is_constant_evaluated() ? FastMath::sinh(x) : std::sinh(x);
+            }
+
+            static constexpr double exp(double x)
+            {
+                return std::is_constant_evaluated() ? FastMath::exp(x) : std::exp(x);
+            }
+
+            static constexpr double pow10(double x)
+            {
+                return std::is_constant_evaluated() ? FastMath::pow10(x) : std::pow(10.0, x);
+            }
+
+            static constexpr double sqrt(double x) { return FastMath::sqrt(x); }
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "DSP/BiQuadFilter.hpp"
+#include "DSP/FastMath.hpp"
 
 namespace audio
 {
@@ -10,13 +11,24 @@ namespace audio
         // Mathematical constants
         constexpr double PI = 3.14159265358979323846;
         constexpr double TWO_PI = 2.0 * PI;
+        constexpr double LN2 = 0.69314718055994530942;
 
         /**
          * Filter design utility class
          * Calculates biquad coefficients for various filter types
          * Based on Robert Bristow-Johnson's Audio EQ Cookbook
+         *
+         * Math selects the transcendental functions (see FastMath.hpp):
+         * FilterDesign is exact, FastFilterDesign trades ~1e-8 coefficient
+         * error for cheaper control-rate updates.
+         *
+         * Every designer is constexpr, so fixed filters can be designed at
+         * compile time (constexpr auto c = FilterDesign::highpass(...)) and
+         * run through FixedBiquad. An invalid frequency or Q is then a
+         * compile error instead of an exception.
          */
-        class FilterDesign
+        template <typename Math>
+        class BasicFilterDesign
         {
         public:
             /**
@@ -27,14 +39,14 @@ namespace audio
              * @param cutoff_freq Cutoff frequency in Hz (-3dB point)
              * @param q_factor Quality factor (resonance), typically 0.707 for Butterworth
              */
-            static BiquadCoefficients lowpass(double sample_rate, double cutoff_freq, double q_factor = 0.707)
+            static constexpr BiquadCoefficients lowpass(double sample_rate, double cutoff_freq, double q_factor = 0.707)
             {
                 validate_frequency(sample_rate, cutoff_freq);
                 validate_q_factor(q_factor);
 
                 double omega = TWO_PI * cutoff_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
                 double alpha = sin_omega / (2.0 * q_factor);
 
                 BiquadCoefficients coeffs;
@@ -57,14 +69,14 @@ namespace audio
              * @param cutoff_freq Cutoff frequency in Hz (-3dB point)
              * @param q_factor Quality factor, typically 0.707 for Butterworth
              */
-            static BiquadCoefficients highpass(double sample_rate, double cutoff_freq, double q_factor = 0.707)
+            static constexpr BiquadCoefficients highpass(double sample_rate, double cutoff_freq, double q_factor = 0.707)
             {
                 validate_frequency(sample_rate, cutoff_freq);
                 validate_q_factor(q_factor);
 
                 double omega = TWO_PI * cutoff_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
                 double alpha = sin_omega / (2.0 * q_factor);
 
                 BiquadCoefficients coeffs;
@@ -87,14 +99,14 @@ namespace audio
              * @param center_freq Center frequency in Hz
              * @param bandwidth Bandwidth in Hz (measured at -3dB points)
              */
-            static BiquadCoefficients bandpass(double sample_rate, double center_freq, double bandwidth)
+            static constexpr BiquadCoefficients bandpass(double sample_rate, double center_freq, double bandwidth)
             {
                 validate_frequency(sample_rate, center_freq);
 
                 double omega = TWO_PI * center_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
-                double alpha = sin_omega * std::sinh(std::log(2.0) / 2.0 * bandwidth * omega / sin_omega);
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
+                double alpha = sin_omega * Math::sinh(LN2 / 2.0 * bandwidth * omega / sin_omega);
 
                 BiquadCoefficients coeffs;
                 coeffs.b0 = alpha;
@@ -116,14 +128,14 @@ namespace audio
              * @param center_freq Frequency to notch out in Hz
              * @param bandwidth Bandwidth of the notch in Hz
              */
-            static BiquadCoefficients notch(double sample_rate, double center_freq, double bandwidth)
+            static constexpr BiquadCoefficients notch(double sample_rate, double center_freq, double bandwidth)
             {
                 validate_frequency(sample_rate, center_freq);
 
                 double omega = TWO_PI * center_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
-                double alpha = sin_omega * std::sinh(std::log(2.0) / 2.0 * bandwidth * omega / sin_omega);
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
+                double alpha = sin_omega * Math::sinh(LN2 / 2.0 * bandwidth * omega / sin_omega);
 
                 BiquadCoefficients coeffs;
                 coeffs.b0 = 1.0;
@@ -146,16 +158,16 @@ namespace audio
              * @param gain_db Gain in decibels (positive = boost, negative = cut)
              * @param bandwidth Bandwidth in octaves
              */
-            static BiquadCoefficients peaking_eq(double sample_rate, double center_freq,
+            static constexpr BiquadCoefficients peaking_eq(double sample_rate, double center_freq,
                                                  double gain_db, double bandwidth)
             {
                 validate_frequency(sample_rate, center_freq);
 
-                double A = std::pow(10.0, gain_db / 40.0); // Amplitude from dB
+                double A = Math::pow10(gain_db / 40.0); // Amplitude from dB
                 double omega = TWO_PI * center_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
-                double alpha = sin_omega * std::sinh(std::log(2.0) / 2.0 * bandwidth * omega / sin_omega);
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
+                double alpha = sin_omega * Math::sinh(LN2 / 2.0 * bandwidth * omega / sin_omega);
 
                 BiquadCoefficients coeffs;
                 coeffs.b0 = 1.0 + alpha * A;
@@ -178,17 +190,17 @@ namespace audio
              * @param gain_db Gain in decibels
              * @param slope Shelf slope (0.5 = gentle, 1.0 = steep)
              */
-            static BiquadCoefficients low_shelf(double sample_rate, double cutoff_freq,
+            static constexpr BiquadCoefficients low_shelf(double sample_rate, double cutoff_freq,
                                                 double gain_db, double slope = 1.0)
             {
                 validate_frequency(sample_rate, cutoff_freq);
 
-                double A = std::pow(10.0, gain_db / 40.0);
+                double A = Math::pow10(gain_db / 40.0);
                 double omega = TWO_PI * cutoff_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
-                double alpha = sin_omega / 2.0 * std::sqrt((A + 1.0 / A) * (1.0 / slope - 1.0) + 2.0);
-                double beta = 2.0 * std::sqrt(A) * alpha;
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
+                double alpha = sin_omega / 2.0 * Math::sqrt((A + 1.0 / A) * (1.0 / slope - 1.0) + 2.0);
+                double beta = 2.0 * Math::sqrt(A) * alpha;
 
                 BiquadCoefficients coeffs;
                 coeffs.b0 = A * ((A + 1.0) - (A - 1.0) * cos_omega + beta);
@@ -211,17 +223,17 @@ namespace audio
              * @param gain_db Gain in decibels
              * @param slope Shelf slope (0.5 = gentle, 1.0 = steep)
              */
-            static BiquadCoefficients high_shelf(double sample_rate, double cutoff_freq,
+            static constexpr BiquadCoefficients high_shelf(double sample_rate, double cutoff_freq,
                                                  double gain_db, double slope = 1.0)
             {
                 validate_frequency(sample_rate, cutoff_freq);
 
-                double A = std::pow(10.0, gain_db / 40.0);
+                double A = Math::pow10(gain_db / 40.0);
                 double omega = TWO_PI * cutoff_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
-                double alpha = sin_omega / 2.0 * std::sqrt((A + 1.0 / A) * (1.0 / slope - 1.0) + 2.0);
-                double beta = 2.0 * std::sqrt(A) * alpha;
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
+                double alpha = sin_omega / 2.0 * Math::sqrt((A + 1.0 / A) * (1.0 / slope - 1.0) + 2.0);
+                double beta = 2.0 * Math::sqrt(A) * alpha;
 
                 BiquadCoefficients coeffs;
                 coeffs.b0 = A * ((A + 1.0) + (A - 1.0) * cos_omega + beta);
@@ -243,14 +255,14 @@ namespace audio
              * @param center_freq Center frequency in Hz
              * @param q_factor Quality factor
              */
-            static BiquadCoefficients allpass(double sample_rate, double center_freq, double q_factor = 0.707)
+            static constexpr BiquadCoefficients allpass(double sample_rate, double center_freq, double q_factor = 0.707)
             {
                 validate_frequency(sample_rate, center_freq);
                 validate_q_factor(q_factor);
 
                 double omega = TWO_PI * center_freq / sample_rate;
-                double cos_omega = std::cos(omega);
-                double sin_omega = std::sin(omega);
+                double cos_omega, sin_omega;
+                Math::sin_cos(omega, sin_omega, cos_omega);
                 double alpha = sin_omega / (2.0 * q_factor);
 
                 BiquadCoefficients coeffs;
@@ -266,7 +278,7 @@ namespace audio
             }
 
         private:
-            static void validate_frequency(double sample_rate, double freq)
+            static constexpr void validate_frequency(double sample_rate, double freq)
             {
                 if (freq <= 0.0 || freq >= sample_rate / 2.0)
                 {
@@ -275,7 +287,7 @@ namespace audio
                 }
             }
 
-            static void validate_q_factor(double q)
+            static constexpr void validate_q_factor(double q)
             {
                 if (q <= 0.0)
                 {
@@ -284,5 +296,8 @@ namespace audio
             }
         };
 
+        using FilterDesign = BasicFilterDesign<StdMath>;
+        using FastFilterDesign = BasicFilterDesign<FastMath>;
+
     } // namespace dsp
 } // namespace audio
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "project.h"
+#include "ChannelDispatch.hpp"
+#include "DSP/BiQuadFilter.hpp"
+#include "DSP/Denormals.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Biquad whose coefficients are template arguments
+         *
+         * For always-on filters that never change (DC blockers, weighting
+         * pre-filters, fixed anti-alias stages). Design the coefficients with
+         * a constexpr FilterDesign call:
+         *
+         *   constexpr auto dc = FilterDesign::highpass(48000.0, 10.0);
+         *   FixedBiquad<dc, float> blocker;
+         *
+         * The coefficients are compile-time constants, so the compiler folds
+         * them into the kernel, and terms whose coefficient is exactly zero
+         * (b2 = a2 = 0 in first-order designs, b1 = 0 in band-passes) are
+         * dropped altogether. Direct Form I in double, channels processed
+         * side by side like BiquadFilter, the lane loop marked
+         * AUDIO_SIMD_LANES so each group runs packed.
+         */
+        template <BiquadCoefficients Coeffs, typename SampleType>
+        class FixedBiquad
+        {
+        public:
+            using value_type = double;
+
+            /// Channels processed together per sweep over interleaved frames
+            static constexpr size_t max_lanes = 8;
+
+            /// Normalised coefficients
+            static constexpr BiquadCoefficients coefficients = []
+            {
+                BiquadCoefficients c = Coeffs;
+                c.normalize();
+                return c;
+            }();
+
+            // Allocate state for num_channels up front (processing then never allocates)
+            void prepare(size_t num_channels)
+            {
+                if (num_channels > state_[0].size())
+                {
+                    for (auto &row : state_)
+                    {
+                        row.resize(num_channels, value_type(0));
+                    }
+                }
+            }
+
+            // Process single sample for one channel
+            SampleType process_sample(SampleType input, size_t channel = 0)
+            {
+                prepare(channel + 1);
+
+                value_type s[4][1] = {{state_[0][channel]}, {state_[1][channel]}, {state_[2][channel]}, {state_[3][channel]}};
+                const value_type y = tick<1>(s, 0, static_cast<value_type>(input));
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    state_[row][channel] = s[row][0];
+                }
+                return simd::saturate_cast<SampleType>(y);
+            }
+
+            // Process entire buffer (interleaved stereo/mono)
+            void process_buffer(SampleType *buffer, size_t num_samples, size_t num_channels)
+            {
+                if (num_samples == 0 || num_channels == 0)
+                    return;
+
+                prepare(num_channels);
+
+                for_each_lane_group<max_lanes>(num_channels, [&](auto lanes, size_t first)
+                {
+                    process_lanes<decltype(lanes)::value>(buffer, num_samples, num_channels, first);
+                });
+            }
+
+            // Reset filter state (clear history)
+            void reset()
+            {
+                for (auto &row : state_)
+                {
+                    std::fill(row.begin(), row.end(), value_type(0));
+                }
+            }
+
+        private:
+            static constexpr value_type b0 = coefficients.b0;
+            static constexpr value_type b1 = coefficients.b1;
+            static constexpr value_type b2 = coefficients.b2;
+            static constexpr value_type a1 = coefficients.a1;
+            static constexpr value_type a2 = coefficients.a2;
+
+            // state rows: 0 = x[n-1], 1 = x[n-2], 2 = y[n-1], 3 = y[n-2]
+            template <size_t Lanes>
+            static value_type tick(value_type (&s)[4][Lanes], size_t lane, value_type x)
+            {
+                value_type y = b0 * x;
+                if constexpr (b1 != 0.0)
+                    y += b1 * s[0][lane];
+                if constexpr (b2 != 0.0)
+                    y += b2 * s[1][lane];
+                if constexpr (a1 != 0.0)
+                    y -= a1 * s[2][lane];
+                if constexpr (a2 != 0.0)
+                    y -= a2 * s[3][lane];
+                y = flush_denormal(y);
+
+                s[1][lane] = s[0][lane];
+                s[0][lane] = x;
+                s[3][lane] = s[2][lane];
+                s[2][lane] = y;
+                return y;
+            }
+
+            template <size_t Lanes>
+            void process_lanes(SampleType *buffer, size_t num_samples, size_t stride, size_t first)
+            {
+                value_type s[4][Lanes];
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        s[row][lane] = state_[row][first + lane];
+                    }
+                }
+
+                for (size_t sample = 0; sample < num_samples; ++sample)
+                {
+                    SampleType *frame = buffer + sample * stride + first;
+                    AUDIO_SIMD_LANES
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        frame[lane] = simd::saturate_cast<SampleType>(tick<Lanes>(s, lane, static_cast<value_type>(frame[lane])));
+                    }
+                }
+
+                for (size_t row = 0; row < 4; ++row)
+                {
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        state_[row][first + lane] = s[row][lane];
+                    }
+                }
+            }
+
+            std::array<std::vector<value_type>, 4> state_;
+        };
+
+    } // namespace dsp
+} // namespace audio
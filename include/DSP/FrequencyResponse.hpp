@@ -0,0 +1,225 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/BiquadCascade.hpp"
+#include "DSP/FilterDesign.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Magnitude and phase of a filter at a set of frequencies
+         */
+        class FrequencyResponse
+        {
+        public:
+            std::vector<double> magnitude; // Linear gain
+            std::vector<double> phase;     // Radians, in (-pi, pi]
+
+            size_t size() const { return magnitude.size(); }
+
+            double magnitude_db(size_t index) const
+            {
+                return 20.0 * std::log10(magnitude.at(index));
+            }
+
+        private:
+            friend class FrequencyGrid;
+
+            // Running complex product while sections are applied
+            std::vector<double> real_;
+            std::vector<double> imag_;
+        };
+
+        /**
+         * Frequencies at which responses are evaluated, with z^-1 and z^-2
+         * precomputed
+         *
+         * The only trig is done once, at construction, so a curve redrawn
+         * every frame costs a handful of multiply-adds per section per point.
+         * Each section is applied across all points in one branch-free loop
+         * over structure-of-arrays data, which the compiler vectorises; the
+         * running product is kept complex so phase needs no unwrapping.
+         */
+        class FrequencyGrid
+        {
+        public:
+            /**
+             * @param sample_rate Sample rate the coefficients were designed for
+             * @param frequencies Evaluation points in Hz
+             */
+            FrequencyGrid(double sample_rate, std::span<const double> frequencies)
+                : sample_rate_(sample_rate), frequencies_(frequencies.begin(), frequencies.end())
+            {
+                if (sample_rate <= 0.0)
+                {
+                    throw std::invalid_argument("Sample rate must be positive");
+                }
+
+                const size_t n = frequencies_.size();
+                z1_real_.resize(n);
+                z1_imag_.resize(n);
+                z2_real_.resize(n);
+                z2_imag_.resize(n);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    // z^-1 = e^(-jw), z^-2 = (z^-1)^2
+                    const double w = TWO_PI * frequencies_[i] / sample_rate;
+                    const double c = std::cos(w);
+                    const double s = -std::sin(w);
+                    z1_real_[i] = c;
+                    z1_imag_[i] = s;
+                    z2_real_[i] = c * c - s * s;
+                    z2_imag_[i] = 2.0 * c * s;
+                }
+            }
+
+            size_t size() const { return frequencies_.size(); }
+            double sample_rate() const { return sample_rate_; }
+            const std::vector<double> &frequencies() const { return frequencies_; }
+
+            /**
+             * Response of a section cascade, written into out
+             * Reusing out across calls avoids reallocating.
+             */
+            void evaluate(std::span<const BiquadCoefficients> sections, FrequencyResponse &out) const
+            {
+                begin(out);
+                for (const auto &coeffs : sections)
+                {
+                    apply(coeffs, out);
+                }
+                finish(out);
+            }
+
+            FrequencyResponse evaluate(std::span<const BiquadCoefficients> sections) const
+            {
+                FrequencyResponse out;
+                evaluate(sections, out);
+                return out;
+            }
+
+            // Incremental form: begin(), apply() per section, finish()
+            void begin(FrequencyResponse &out) const
+            {
+                out.real_.assign(size(), 1.0);
+                out.imag_.assign(size(), 0.0);
+            }
+
+            // Multiply the running response by one section's H(z)
+            void apply(const BiquadCoefficients &coeffs, FrequencyResponse &out) const
+            {
+                const double inv_a0 = 1.0 / (std::abs(coeffs.a0) < 1e-10 ? 1.0 : coeffs.a0);
+                const double b0 = coeffs.b0 * inv_a0, b1 = coeffs.b1 * inv_a0, b2 = coeffs.b2 * inv_a0;
+                const double a1 = coeffs.a1 * inv_a0, a2 = coeffs.a2 * inv_a0;
+
+                const double *AUDIO_RESTRICT z1r = z1_real_.data();
+                const double *AUDIO_RESTRICT z1i = z1_imag_.data();
+                const double *AUDIO_RESTRICT z2r = z2_real_.data();
+                const double *AUDIO_RESTRICT z2i = z2_imag_.data();
+                double *AUDIO_RESTRICT hr = out.real_.data();
+                double *AUDIO_RESTRICT hi = out.imag_.data();
+                const size_t n = size();
+
+                AUDIO_SIMD_LOOP
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const double nr = b0 + b1 * z1r[i] + b2 * z2r[i];
+                    const double ni = b1 * z1i[i] + b2 * z2i[i];
+                    const double dr = 1.0 + a1 * z1r[i] + a2 * z2r[i];
+                    const double di = a1 * z1i[i] + a2 * z2i[i];
+
+                    // q = n / d
+                    const double inv = 1.0 / (dr * dr + di * di);
+                    const double qr = (nr * dr + ni * di) * inv;
+                    const double qi = (ni * dr - nr * di) * inv;
+
+                    const double r = hr[i] * qr - hi[i] * qi;
+                    hi[i] = hr[i] * qi + hi[i] * qr;
+                    hr[i] = r;
+                }
+            }
+
+            // Convert the running product to magnitude and phase
+            void finish(FrequencyResponse &out) const
+            {
+                const size_t n = size();
+                out.magnitude.resize(n);
+                out.phase.resize(n);
+
+                const double *AUDIO_RESTRICT hr = out.real_.data();
+                const double *AUDIO_RESTRICT hi = out.imag_.data();
+                double *AUDIO_RESTRICT magnitude = out.magnitude.data();
+
+                AUDIO_SIMD_LOOP
+                for (size_t i = 0; i < n; ++i)
+                {
+                    magnitude[i] = std::sqrt(hr[i] * hr[i] + hi[i] * hi[i]);
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    out.phase[i] = std::atan2(hi[i], hr[i]);
+                }
+            }
+
+        private:
+            double sample_rate_;
+            std::vector<double> frequencies_;
+            std::vector<double> z1_real_, z1_imag_;
+            std::vector<double> z2_real_, z2_imag_;
+        };
+
+        /**
+         * One-off responses
+         * For repeated redraws keep a FrequencyGrid and FrequencyResponse
+         * and use the grid overloads.
+         */
+        inline FrequencyResponse frequency_response(const BiquadCoefficients &coeffs, double sample_rate,
+                                                    std::span<const double> frequencies)
+        {
+            return FrequencyGrid(sample_rate, frequencies).evaluate(std::span<const BiquadCoefficients>(&coeffs, 1));
+        }
+
+        inline FrequencyResponse frequency_response(std::span<const BiquadCoefficients> sections, double sample_rate,
+                                                    std::span<const double> frequencies)
+        {
+            return FrequencyGrid(sample_rate, frequencies).evaluate(sections);
+        }
+
+        template <typename SampleType, typename Policy>
+        FrequencyResponse frequency_response(const BiquadFilter<SampleType, Policy> &filter, double sample_rate,
+                                             std::span<const double> frequencies)
+        {
+            return frequency_response(filter.coefficients(), sample_rate, frequencies);
+        }
+
+        // Cascade response (enabled sections only)
+        template <typename SampleType, typename Policy>
+        void frequency_response(const BiquadCascade<SampleType, Policy> &cascade, const FrequencyGrid &grid,
+                                FrequencyResponse &out)
+        {
+            grid.begin(out);
+            for (size_t i = 0; i < cascade.num_sections(); ++i)
+            {
+                if (cascade.is_section_enabled(i))
+                {
+                    grid.apply(cascade.section(i), out);
+                }
+            }
+            grid.finish(out);
+        }
+
+        template <typename SampleType, typename Policy>
+        FrequencyResponse frequency_response(const BiquadCascade<SampleType, Policy> &cascade, double sample_rate,
+                                             std::span<const double> frequencies)
+        {
+            FrequencyResponse out;
+            frequency_response(cascade, FrequencyGrid(sample_rate, frequencies), out);
+            return out;
+        }
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/FIRDesign.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Linear-phase half-band lowpass (cutoff at a quarter of the rate)
+         *
+         * Every second tap away from the centre is exactly zero, so a 2x
+         * interpolator or decimator splits into two polyphase branches: one
+         * FIR over the (num_taps + 1) / 2 non-zero taps and one pure delay
+         * through the centre tap. That halves the work of the FIR again on
+         * top of skipping the zero-stuffed (or discarded) samples.
+         */
+        struct HalfBandDesign
+        {
+            /**
+             * @param num_taps Filter length, 4k + 3 (7, 11, ..., 47, ...)
+             * @param beta Kaiser shape (see FIRDesign::lowpass)
+             */
+            static std::vector<double> design(size_t num_taps, double beta = 8.0)
+            {
+                if (num_taps < 3 || num_taps % 4 != 3)
+                {
+                    throw std::invalid_argument("Half-band filter length must be 4k + 3");
+                }
+
+                std::vector<double> taps = FIRDesign::lowpass(4.0, 1.0, num_taps, beta);
+
+                // Zero the taps the ideal response has at even offsets from the centre
+                const size_t centre = num_taps / 2;
+                for (size_t j = 0; j < num_taps; ++j)
+                {
+                    if (j != centre && (j % 2) == (centre % 2))
+                    {
+                        taps[j] = 0.0;
+                    }
+                }
+                return taps;
+            }
+        };
+
+        /**
+         * 2x half-band upsampler for one contiguous channel
+         * Delay: (num_taps - 1) / 2 samples at the output rate.
+         */
+        template <typename T>
+        class HalfBandInterpolator
+        {
+        public:
+            explicit HalfBandInterpolator(std::span<const double> taps)
+            {
+                const size_t centre = taps.size() / 2;
+                delay_ = centre / 2;
+
+                // Non-zero branch (even tap indices), reversed, gain 2 for zero stuffing
+                branch_.resize(centre + 1);
+                for (size_t i = 0; i < branch_.size(); ++i)
+                {
+                    branch_[i] = static_cast<T>(2.0 * taps[2 * (branch_.size() - 1 - i)]);
+                }
+                centre_gain_ = static_cast<T>(2.0 * taps[centre]);
+                reset();
+            }
+
+            /**
+             * @param in num_samples input samples
+             * @param out 2 * num_samples output samples
+             */
+            void process(const T *in, size_t num_samples, T *out)
+            {
+                const size_t past = branch_.size() - 1;
+                history_.resize(past + num_samples);
+                std::copy(in, in + num_samples, history_.begin() + past);
+                acc_.assign(num_samples, T(0));
+
+                const T *AUDIO_RESTRICT x = history_.data();
+                T *AUDIO_RESTRICT acc = acc_.data();
+                for (size_t i = 0; i < branch_.size(); ++i)
+                {
+                    const T h = branch_[i];
+                    AUDIO_SIMD_LOOP
+                    for (size_t n = 0; n < num_samples; ++n)
+                    {
+                        acc[n] += h * x[n + i];
+                    }
+                }
+
+                // Even outputs from the FIR branch, odd ones are the delayed input
+                for (size_t n = 0; n < num_samples; ++n)
+                {
+                    out[2 * n] = acc[n];
+                    out[2 * n + 1] = centre_gain_ * x[past + n - delay_];
+                }
+
+                std::copy(history_.end() - past, history_.end(), history_.begin());
+                history_.resize(past);
+            }
+
+            void reset()
+            {
+                history_.assign(branch_.size() - 1, T(0));
+            }
+
+        private:
+            std::vector<T> branch_;
+            T centre_gain_ = 0;
+            size_t delay_ = 0;
+            std::vector<T> history_;
+            std::vector<T> acc_;
+        };
+
+        /**
+         * 2x half-band downsampler for one contiguous channel
+         * Delay: (num_taps - 1) / 2 samples at the input rate.
+         */
+        template <typename T>
+        class HalfBandDecimator
+        {
+        public:
+            explicit HalfBandDecimator(std::span<const double> taps)
+            {
+                const size_t centre = taps.size() / 2;
+                delay_ = centre / 2 + 1;
+
+                branch_.resize(centre + 1);
+                for (size_t i = 0; i < branch_.size(); ++i)
+                {
+                    branch_[i] = static_cast<T>(taps[2 * (branch_.size() - 1 - i)]);
+                }
+                centre_gain_ = static_cast<T>(taps[centre]);
+                reset();
+            }
+
+            /**
+             * @param in 2 * num_samples input samples
+             * @param out num_samples output samples
+             */
+            void process(const T *in, size_t num_samples, T *out)
+            {
+                const size_t past = branch_.size() - 1;
+                even_.resize(past + num_samples);
+                odd_.resize(delay_ + num_samples);
+                for (size_t n = 0; n < num_samples; ++n)
+                {
+                    even_[past + n] = in[2 * n];
+                    odd_[delay_ + n] = in[2 * n + 1];
+                }
+
+                const T *AUDIO_RESTRICT e = even_.data();
+                const T *AUDIO_RESTRICT o = odd_.data();
+                T *AUDIO_RESTRICT y = out;
+
+                // The odd branch is a delay through the centre tap
+                AUDIO_SIMD_LOOP
+                for (size_t n = 0; n < num_samples; ++n)
+                {
+                    y[n] = centre_gain_ * o[n];
+                }
+                for (size_t i = 0; i < branch_.size(); ++i)
+                {
+                    const T h = branch_[i];
+                    AUDIO_SIMD_LOOP
+                    for (size_t n = 0; n < num_samples; ++n)
+                    {
+                        y[n] += h * e[n + i];
+                    }
+                }
+
+                std::copy(even_.end() - past, even_.end(), even_.begin());
+                even_.resize(past);
+                std::copy(odd_.end() - delay_, odd_.end(), odd_.begin());
+                odd_.resize(delay_);
+            }
+
+            void reset()
+            {
+                even_.assign(branch_.size() - 1, T(0));
+                odd_.assign(delay_, T(0));
+            }
+
+        private:
+            std::vector<T> branch_;
+            T centre_gain_ = 0;
+            size_t delay_ = 0;
+            std::vector<T> even_;
+            std::vector<T> odd_;
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,406 @@
+#pragma once
+
+#include "project.h"
+#include "ThreadPool.hpp"
+#include "DSP/BiQuadFilter.hpp"
+#include "DSP/FrequencyResponse.hpp"
+#include "DSP/FIRDesign.hpp"
+#include "DSP/FIRFilter.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Designs linear-phase EQ kernels in the background on a ThreadPool
+         *
+         * request() records the latest band set and posts a design task to
+         * the pool unless one is already running; that task keeps designing
+         * until it has caught up with the latest request, so a burst of
+         * parameter changes costs at most one extra design. A pool without
+         * workers designs inline in request().
+         *
+         * A new kernel must continue from the input the old one has seen.
+         * Once designed, the task waits up to snapshot_timeout for a snapshot
+         * of the EQ's input history (offer_history() from the audio thread,
+         * or wait() when rendering offline) and primes the kernel with it, so
+         * the audio thread only feeds the few frames that arrived since. If
+         * none arrives (processing stopped), the kernel is published unprimed
+         * and the pool thread is released; the EQ then primes it from its
+         * own history when processing resumes.
+         *
+         * The audio thread side (offer_history(), exchange(), retire()) never
+         * blocks or allocates. Replaced kernels are freed by the next task or
+         * control call. Each published kernel comes with its own magnitude
+         * response (an FFT of its taps), see response().
+         */
+        template <typename SampleType>
+        class LinearPhaseBuilder
+        {
+        public:
+            using Filter = FIRFilter<SampleType>;
+
+            /// Magnitude of a designed kernel at grid_size(num_taps) / 2 + 1 bins, DC to Nyquist
+            using Response = std::shared_ptr<const std::vector<double>>;
+
+            /// A kernel and the response it actually has
+            struct Design
+            {
+                std::unique_ptr<Filter> filter;
+                Response response;
+            };
+
+            struct Spec
+            {
+                std::vector<BiquadCoefficients> sections;
+                double sample_rate = 0.0;
+                size_t num_taps = 0;
+                size_t num_channels = 0;
+            };
+
+            /// Replaced kernels that can wait to be freed
+            static constexpr size_t retire_capacity = 4;
+
+            /// How long a finished design waits for the audio thread's history
+            static constexpr std::chrono::milliseconds default_snapshot_timeout{100};
+
+            explicit LinearPhaseBuilder(ThreadPool &pool = ThreadPool::shared(),
+                                        std::chrono::milliseconds snapshot_timeout = default_snapshot_timeout)
+                : pool_(pool), snapshot_timeout_(snapshot_timeout)
+            {
+                retired_.reserve(retire_capacity);
+            }
+
+            ~LinearPhaseBuilder()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                stop_ = true;
+                wake_.notify_all();
+                idle_.wait(lock, [this]
+                           { return !running_; });
+            }
+
+            LinearPhaseBuilder(const LinearPhaseBuilder &) = delete;
+            LinearPhaseBuilder &operator=(const LinearPhaseBuilder &) = delete;
+
+            void request(Spec spec)
+            {
+                std::vector<std::unique_ptr<Filter>> garbage;
+                bool start = false;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    spec_ = std::move(spec);
+                    ++requested_;
+                    garbage.swap(retired_);
+                    retired_.reserve(retire_capacity);
+                    start = !running_;
+                    running_ = true;
+                }
+                if (start)
+                {
+                    pool_.post([this]
+                               { run(); });
+                }
+            }
+
+            /**
+             * Drop the pending request and any kernel not yet collected
+             * A running task stops at its next check; call it while nothing is processing.
+             */
+            void cancel()
+            {
+                std::unique_ptr<Filter> dropped;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    built_ = ++requested_; // Supersedes a design in flight
+                    snapshot_wanted_.store(false, std::memory_order_relaxed);
+                    dropped = std::move(ready_);
+                    has_ready_.store(false, std::memory_order_release);
+                }
+                wake_.notify_all();
+                idle_.notify_all();
+            }
+
+            /**
+             * Block until the latest request is ready to be collected
+             * For offline use while nothing is processing: history and
+             * position stand in for the audio thread's snapshot. Rethrows
+             * an exception thrown by a design since the last call.
+             */
+            void wait(std::span<const SampleType> history, uint64_t position)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (true)
+                {
+                    idle_.wait(lock, [this]
+                               { return built_ == requested_ || snapshot_wanted_.load(std::memory_order_relaxed); });
+                    if (built_ == requested_)
+                    {
+                        if (error_)
+                        {
+                            std::rethrow_exception(std::exchange(error_, nullptr));
+                        }
+                        return;
+                    }
+                    store_snapshot(history, position);
+                    wake_.notify_all();
+                }
+            }
+
+            /**
+             * Response of the most recently published kernel
+             * Null until the first design is published; lags a request
+             * still being designed.
+             */
+            Response response() const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return response_;
+            }
+
+            /// True while a design task is queued or running
+            bool busy() const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return running_;
+            }
+
+            /**
+             * Hand over the input history if a design asked for it
+             * (real-time safe; skipped if the task holds the lock)
+             * @param position Input frames seen up to the end of history
+             */
+            void offer_history(std::span<const SampleType> history, uint64_t position)
+            {
+                if (!snapshot_wanted_.load(std::memory_order_acquire))
+                {
+                    return;
+                }
+                std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+                if (lock.owns_lock() && snapshot_wanted_.load(std::memory_order_relaxed))
+                {
+                    store_snapshot(history, position);
+                    lock.unlock();
+                    wake_.notify_one(); // Once per designed kernel
+                }
+            }
+
+            /**
+             * Collect a finished kernel if one is ready (real-time safe)
+             * @param primed Set to the input position the kernel is primed
+             *               up to; 0 for an unprimed kernel
+             * @return The new kernel, or null
+             */
+            std::unique_ptr<Filter> exchange(uint64_t &primed)
+            {
+                if (!has_ready_.load(std::memory_order_acquire))
+                {
+                    return nullptr;
+                }
+                std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+                if (!lock.owns_lock() || !ready_)
+                {
+                    return nullptr;
+                }
+
+                has_ready_.store(false, std::memory_order_release);
+                primed = ready_position_;
+                return std::move(ready_);
+            }
+
+            /**
+             * Queue a replaced kernel to be freed off the audio thread (real-time safe)
+             * @return False if the queue is busy or full; try again later
+             */
+            bool retire(std::unique_ptr<Filter> &kernel)
+            {
+                std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+                if (!lock.owns_lock() || retired_.size() >= retire_capacity)
+                {
+                    return false;
+                }
+                retired_.push_back(std::move(kernel));
+                return true;
+            }
+
+            /// Design and response grid: a power of two at least four times the kernel
+            static size_t grid_size(size_t num_taps)
+            {
+                size_t fft_size = 2;
+                while (fft_size < 4 * num_taps)
+                {
+                    fft_size *= 2;
+                }
+                return fft_size;
+            }
+
+            /**
+             * Composite magnitude of the sections -> frequency-sampled FIR
+             * The window smooths the magnitude, so the kernel's response (an
+             * FFT of the taps on the same grid) comes back with it.
+             */
+            static Design design(const Spec &spec)
+            {
+                const size_t fft_size = grid_size(spec.num_taps);
+
+                std::vector<double> frequencies(fft_size / 2 + 1);
+                for (size_t k = 0; k < frequencies.size(); ++k)
+                {
+                    frequencies[k] = spec.sample_rate * static_cast<double>(k) / static_cast<double>(fft_size);
+                }
+
+                const auto response = frequency_response(std::span<const BiquadCoefficients>(spec.sections),
+                                                         spec.sample_rate, frequencies);
+                const auto taps = FIRDesign::from_magnitude(response.magnitude, spec.num_taps);
+
+                auto filter = std::make_unique<Filter>(taps);
+                filter->prepare(spec.num_channels);
+
+                std::vector<double> padded(fft_size, 0.0);
+                std::copy(taps.begin(), taps.end(), padded.begin());
+                const auto fft = FFT<double>::plan(fft_size);
+                std::vector<std::complex<double>> bins(fft->num_bins());
+                fft->forward_real(padded.data(), bins.data());
+
+                auto magnitude = std::make_shared<std::vector<double>>(bins.size());
+                for (size_t k = 0; k < bins.size(); ++k)
+                {
+                    (*magnitude)[k] = std::abs(bins[k]);
+                }
+                return {std::move(filter), std::move(magnitude)};
+            }
+
+        private:
+            // Called with mutex_ held
+            void store_snapshot(std::span<const SampleType> history, uint64_t position)
+            {
+                snapshot_valid_ = history.size() == snapshot_.size();
+                if (snapshot_valid_)
+                {
+                    std::copy(history.begin(), history.end(), snapshot_.begin());
+                }
+                snapshot_position_ = position;
+                snapshot_wanted_.store(false, std::memory_order_relaxed);
+            }
+
+            // Design task: runs until it has built the latest request
+            void run()
+            {
+                // Inline on the control thread nobody can offer a snapshot
+                const bool background = pool_.num_threads() > 1;
+
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (!stop_ && built_ != requested_)
+                {
+                    std::vector<std::unique_ptr<Filter>> garbage;
+                    garbage.swap(retired_);
+                    retired_.reserve(retire_capacity);
+
+                    const Spec spec = spec_;
+                    const uint64_t generation = requested_;
+                    lock.unlock();
+
+                    garbage.clear();
+                    Design designed;
+                    std::vector<SampleType> history;
+                    try
+                    {
+                        designed = design(spec);
+                        history.resize((spec.num_taps - 1) * spec.num_channels);
+                    }
+                    catch (...)
+                    {
+                        // The current kernel stays; wait() reports the failure
+                        lock.lock();
+                        error_ = std::current_exception();
+                        if (requested_ == generation)
+                        {
+                            built_ = generation;
+                        }
+                        continue;
+                    }
+
+                    lock.lock();
+                    if (stop_ || requested_ != generation)
+                    {
+                        continue; // Superseded: design the latest instead
+                    }
+
+                    uint64_t position = 0; // Unprimed unless a snapshot arrives
+                    if (background)
+                    {
+                        snapshot_ = std::move(history);
+                        snapshot_wanted_.store(true, std::memory_order_release);
+                        idle_.notify_all();
+                        wake_.wait_for(lock, snapshot_timeout_, [&]
+                                       { return stop_ || requested_ != generation || !snapshot_wanted_.load(std::memory_order_relaxed); });
+
+                        const bool answered = !snapshot_wanted_.load(std::memory_order_relaxed);
+                        snapshot_wanted_.store(false, std::memory_order_relaxed);
+                        if (stop_ || requested_ != generation)
+                        {
+                            continue;
+                        }
+
+                        // An unusable snapshot (channel count changed) leaves the kernel unprimed too
+                        if (answered && snapshot_valid_)
+                        {
+                            position = snapshot_position_;
+                            history = std::move(snapshot_);
+                            lock.unlock();
+                            designed.filter->process_buffer(history.data(), spec.num_taps - 1, spec.num_channels);
+                            lock.lock();
+                            if (stop_ || requested_ != generation)
+                            {
+                                continue;
+                            }
+                        }
+                    }
+
+                    ready_ = std::move(designed.filter);
+                    response_ = std::move(designed.response);
+                    ready_position_ = position;
+                    built_ = generation;
+                    has_ready_.store(true, std::memory_order_release);
+                    idle_.notify_all();
+                }
+
+                running_ = false;
+                idle_.notify_all();
+            }
+
+            ThreadPool &pool_;
+            const std::chrono::milliseconds snapshot_timeout_;
+
+            mutable std::mutex mutex_;
+            std::condition_variable wake_; // Task: snapshot, new request, cancel or shutdown
+            std::condition_variable idle_; // wait() / destructor: kernel ready, snapshot wanted or task done
+            bool stop_ = false;
+            bool running_ = false; // A design task is queued or running
+
+            Spec spec_;
+            uint64_t requested_ = 0;
+            uint64_t built_ = 0;
+
+            std::vector<SampleType> snapshot_; // Sized by the task before asking
+            uint64_t snapshot_position_ = 0;
+            bool snapshot_valid_ = false;
+            std::atomic<bool> snapshot_wanted_{false};
+
+            std::unique_ptr<Filter> ready_;
+            uint64_t ready_position_ = 0; // Input frames the ready kernel has seen
+            std::atomic<bool> has_ready_{false};
+            std::vector<std::unique_ptr<Filter>> retired_; // Reserved to retire_capacity
+            Response response_;                            // Of the latest published kernel
+            std::exception_ptr error_;                     // Failed design, for wait()
+        };
+
+    } // namespace dsp
+} // namespace audio
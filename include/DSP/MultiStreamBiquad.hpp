@@ -0,0 +1,315 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/BiQuadFilter.hpp"
+#include "DSP/Denormals.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Biquad cascades for many independent mono streams at once
+         *
+         * Built for servers running thousands of short streams (voice
+         * calls), where one BiquadFilter per stream leaves most of a vector
+         * register idle and scatters state across the heap. Here every
+         * coefficient and state term is one array indexed by stream slot
+         * (structure of arrays), and process() runs max_lanes streams side by
+         * side: a block of each stream is transposed into a frame-major
+         * scratch tile, every section sweeps the tile with one lane per
+         * stream (per-lane coefficients), and the result is written back.
+         *
+         * Capacity is fixed at construction. add_stream() takes a slot from
+         * a free list and remove_stream() returns it, so neither allocates;
+         * groups of lanes with no active stream are skipped. A stream without
+         * a buffer in a call keeps its history for the next one.
+         */
+        template <typename SampleType, typename Policy = DoubleDF1>
+        class MultiStreamBiquad
+        {
+        public:
+            using value_type = typename Policy::value_type;
+            using StreamId = size_t;
+
+            /// Streams processed together in one tile
+            static constexpr size_t max_lanes = 8;
+
+            /// Frames per tile (max_lanes * tile_frames values stay in L1)
+            static constexpr size_t tile_frames = 256;
+
+            /**
+             * @param max_streams Number of stream slots to allocate
+             * @param num_sections Sections per stream (unused ones pass through)
+             */
+            MultiStreamBiquad(size_t max_streams, size_t num_sections)
+                : capacity_((max_streams + max_lanes - 1) / max_lanes * max_lanes), num_sections_(num_sections)
+            {
+                if (max_streams == 0 || num_sections == 0)
+                {
+                    throw std::invalid_argument("Stream count and section count must be positive");
+                }
+
+                coeffs_.assign(num_sections_ * coeff_rows * capacity_, value_type(0));
+                state_.assign(num_sections_ * Policy::state_size * capacity_, value_type(0));
+                active_.assign(capacity_, false);
+                tile_.resize(tile_frames * max_lanes);
+
+                // Lowest slots are handed out first
+                free_.reserve(capacity_);
+                for (size_t slot = capacity_; slot-- > 0;)
+                {
+                    free_.push_back(slot);
+                    clear_slot(slot);
+                }
+            }
+
+            /**
+             * Claim a slot for a new stream
+             * @param sections Up to num_sections() sections; the rest pass through
+             * @return Stream id (slot index) for the other calls and process()
+             */
+            StreamId add_stream(std::span<const BiquadCoefficients> sections = {})
+            {
+                if (free_.empty())
+                {
+                    throw std::runtime_error("No free stream slots");
+                }
+                if (sections.size() > num_sections_)
+                {
+                    throw std::invalid_argument("Too many sections for this engine");
+                }
+
+                const StreamId id = free_.back();
+                free_.pop_back();
+                active_[id] = true;
+                ++num_streams_;
+
+                for (size_t i = 0; i < sections.size(); ++i)
+                {
+                    set_section(id, i, sections[i]);
+                }
+                return id;
+            }
+
+            // Release a stream's slot (its filters and history are cleared)
+            void remove_stream(StreamId id)
+            {
+                if (id < capacity_ && active_[id])
+                {
+                    active_[id] = false;
+                    --num_streams_;
+                    clear_slot(id);
+                    free_.push_back(id);
+                }
+            }
+
+            void set_section(StreamId id, size_t section, const BiquadCoefficients &coeffs)
+            {
+                check_stream(id);
+                if (section >= num_sections_)
+                {
+                    throw std::out_of_range("Section index out of range");
+                }
+
+                BiquadCoefficients c = coeffs;
+                c.normalize();
+                const double values[coeff_rows] = {c.b0, c.b1, c.b2, c.a1, c.a2};
+                for (size_t k = 0; k < coeff_rows; ++k)
+                {
+                    coeff_row(section, k)[id] = static_cast<value_type>(values[k]);
+                }
+            }
+
+            // Clear one stream's history
+            void reset_stream(StreamId id)
+            {
+                check_stream(id);
+                for (size_t row = 0; row < num_sections_ * Policy::state_size; ++row)
+                {
+                    state_[row * capacity_ + id] = value_type(0);
+                }
+            }
+
+            size_t capacity() const { return capacity_; }
+            size_t num_sections() const { return num_sections_; }
+            size_t num_streams() const { return num_streams_; }
+            bool is_active(StreamId id) const { return id < capacity_ && active_[id]; }
+
+            /**
+             * Filter one block of every active stream in place
+             * @param streams Mono buffers indexed by stream id; entries past
+             *                the end, null or belonging to free slots are skipped
+             * @param num_samples Samples in each buffer
+             */
+            void process(std::span<SampleType *const> streams, size_t num_samples)
+            {
+                if (num_samples == 0 || num_streams_ == 0)
+                    return;
+
+                ScopedNoDenormals no_denormals;
+                const size_t used = std::min(streams.size(), capacity_);
+
+                for (size_t first = 0; first < used; first += max_lanes)
+                {
+                    SampleType *lanes[max_lanes] = {};
+                    bool any = false;
+                    for (size_t lane = 0; lane < max_lanes && first + lane < used; ++lane)
+                    {
+                        if (active_[first + lane] && streams[first + lane] != nullptr)
+                        {
+                            lanes[lane] = streams[first + lane];
+                            any = true;
+                        }
+                    }
+
+                    if (any)
+                    {
+                        process_group(lanes, first, num_samples);
+                    }
+                }
+            }
+
+            // Reset every stream's history
+            void reset()
+            {
+                std::fill(state_.begin(), state_.end(), value_type(0));
+            }
+
+        private:
+            static constexpr size_t coeff_rows = 5; // b0, b1, b2, a1, a2
+
+            value_type *coeff_row(size_t section, size_t k)
+            {
+                return coeffs_.data() + (section * coeff_rows + k) * capacity_;
+            }
+
+            value_type *state_row(size_t section, size_t r)
+            {
+                return state_.data() + (section * Policy::state_size + r) * capacity_;
+            }
+
+            void check_stream(StreamId id) const
+            {
+                if (!is_active(id))
+                {
+                    throw std::out_of_range("Stream id is not active");
+                }
+            }
+
+            // Pass-through sections and silent history
+            void clear_slot(size_t slot)
+            {
+                for (size_t section = 0; section < num_sections_; ++section)
+                {
+                    for (size_t k = 0; k < coeff_rows; ++k)
+                    {
+                        coeff_row(section, k)[slot] = value_type(k == 0 ? 1 : 0);
+                    }
+                    for (size_t r = 0; r < Policy::state_size; ++r)
+                    {
+                        state_row(section, r)[slot] = value_type(0);
+                    }
+                }
+            }
+
+            // One group of max_lanes slots starting at first; null lanes run on silence and are not stored
+            void process_group(SampleType *const (&lanes)[max_lanes], size_t first, size_t num_samples)
+            {
+                unsigned mask = 0;
+                for (size_t lane = 0; lane < max_lanes; ++lane)
+                {
+                    mask |= lanes[lane] != nullptr ? 1u << lane : 0u;
+                }
+
+                for (size_t start = 0; start < num_samples; start += tile_frames)
+                {
+                    const size_t count = std::min(tile_frames, num_samples - start);
+                    value_type *AUDIO_RESTRICT tile = tile_.data();
+
+                    // Transpose in: tile[frame][lane]
+                    for (size_t lane = 0; lane < max_lanes; ++lane)
+                    {
+                        const SampleType *in = lanes[lane];
+                        for (size_t n = 0; n < count; ++n)
+                        {
+                            tile[n * max_lanes + lane] = in ? static_cast<value_type>(in[start + n]) : value_type(0);
+                        }
+                    }
+
+                    for (size_t section = 0; section < num_sections_; ++section)
+                    {
+                        process_section(tile, count, section, first, mask);
+                    }
+
+                    // Transpose out
+                    for (size_t lane = 0; lane < max_lanes; ++lane)
+                    {
+                        SampleType *out = lanes[lane];
+                        if (out == nullptr)
+                            continue;
+                        for (size_t n = 0; n < count; ++n)
+                        {
+                            out[start + n] = simd::saturate_cast<SampleType>(tile[n * max_lanes + lane]);
+                        }
+                    }
+                }
+            }
+
+            void process_section(value_type *AUDIO_RESTRICT tile, size_t count, size_t section, size_t first, unsigned mask)
+            {
+                value_type c[coeff_rows][max_lanes];
+                value_type s[Policy::state_size][max_lanes];
+                for (size_t lane = 0; lane < max_lanes; ++lane)
+                {
+                    for (size_t k = 0; k < coeff_rows; ++k)
+                    {
+                        c[k][lane] = coeff_row(section, k)[first + lane];
+                    }
+                    for (size_t r = 0; r < Policy::state_size; ++r)
+                    {
+                        s[r][lane] = state_row(section, r)[first + lane];
+                    }
+                }
+
+                for (size_t n = 0; n < count; ++n)
+                {
+                    value_type *frame = tile + n * max_lanes;
+                    AUDIO_SIMD_LANES
+                    for (size_t lane = 0; lane < max_lanes; ++lane)
+                    {
+                        const BiquadLaneCoefficients<value_type> lane_coeffs{c[0][lane], c[1][lane], c[2][lane], c[3][lane], c[4][lane]};
+                        frame[lane] = Policy::template tick<max_lanes>(lane_coeffs, s, lane, frame[lane]);
+                    }
+                }
+
+                // Only lanes that had a buffer advance their history
+                for (size_t r = 0; r < Policy::state_size; ++r)
+                {
+                    for (size_t lane = 0; lane < max_lanes; ++lane)
+                    {
+                        if (mask & (1u << lane))
+                        {
+                            state_row(section, r)[first + lane] = s[r][lane];
+                        }
+                    }
+                }
+            }
+
+            size_t capacity_;
+            size_t num_sections_;
+            size_t num_streams_ = 0;
+
+            // [section][coefficient][slot] and [section][state term][slot]
+            std::vector<value_type> coeffs_;
+            std::vector<value_type> state_;
+
+            std::vector<bool> active_;
+            std::vector<StreamId> free_; // Reserved to capacity, never reallocates
+            std::vector<value_type> tile_;
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,266 @@
+#pragma once
+
+#include "project.h"
+#include "ThreadPool.hpp"
+#include "DSP/BiQuadFilter.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Time-parallel biquad for long mono signals
+         *
+         * A recursive filter is serial in time, but it is linear: the output
+         * of a segment is its response from zero feedback state plus the
+         * zero-input response of the state it inherits. So the signal is cut
+         * into one segment per thread and
+         *   1. every segment is filtered concurrently with its real input
+         *      history and zero output history,
+         *   2. the true output state at each boundary is propagated serially,
+         *      one 2x2 companion-matrix step per segment,
+         *   3. each segment adds its inherited state's zero-input response,
+         *      which for a stable filter decays within a few thousand samples.
+         * Results match BiquadFilter (DF1, double) to rounding error. The
+         * passes work on a double copy of the output, so each sample is
+         * rounded (and for integer types saturated) once, on write-back.
+         * Short signals, or a single-thread pool, run serially.
+         */
+        template <typename SampleType>
+        class ParallelBiquad
+        {
+        public:
+            /// Segments shorter than this are not worth a thread
+            static constexpr size_t min_segment_length = 16384;
+
+            explicit ParallelBiquad(const BiquadCoefficients &coeffs, ThreadPool &pool = ThreadPool::shared())
+                : pool_(pool)
+            {
+                set_coefficients(coeffs);
+            }
+
+            void set_coefficients(const BiquadCoefficients &coeffs)
+            {
+                coeffs_ = coeffs;
+                coeffs_.normalize();
+                response_length_ = 0; // Zero-input responses are rebuilt lazily
+                cached_segment_length_ = 0;
+            }
+
+            const BiquadCoefficients &coefficients() const { return coeffs_; }
+
+            // History carried from the previous call
+            const BiquadState &state() const { return state_; }
+            void set_state(const BiquadState &state) { state_ = state; }
+
+            void reset() { state_.reset(); }
+
+            /**
+             * Filter a contiguous mono signal in place, continuing from state()
+             */
+            void process(SampleType *data, size_t num_samples)
+            {
+                const size_t segments = std::min(pool_.num_threads(), num_samples / min_segment_length);
+                if (segments < 2)
+                {
+                    run_segment(data, data, num_samples, state_);
+                    return;
+                }
+
+                const size_t segment_length = (num_samples + segments - 1) / segments;
+                prepare_responses(segment_length);
+
+                // Starting history per segment: real inputs, zero feedback
+                // (segment 0 inherits the full carried state)
+                std::vector<BiquadState> starts(segments);
+                starts[0] = state_;
+                for (size_t k = 1; k < segments; ++k)
+                {
+                    const size_t first = k * segment_length;
+                    starts[k].x1 = static_cast<double>(data[first - 1]);
+                    starts[k].x2 = static_cast<double>(data[first - 2]);
+                }
+                const double last_x1 = static_cast<double>(data[num_samples - 1]);
+                const double last_x2 = static_cast<double>(data[num_samples - 2]);
+
+                // 1. Zero-state passes into the double scratch
+                output_.resize(num_samples);
+                std::vector<BiquadState> ends(segments);
+                pool_.parallel_for(segments, [&](size_t k)
+                {
+                    const size_t first = k * segment_length;
+                    const size_t count = std::min(segment_length, num_samples - first);
+                    BiquadState s = starts[k];
+                    run_segment(data + first, output_.data() + first, count, s);
+                    ends[k] = s;
+                });
+
+                // 2. Propagate the true feedback state across boundaries;
+                //    only the last segment can be shorter, so one matrix serves
+                for (size_t k = 1; k < segments; ++k)
+                {
+                    const double y1 = ends[k - 1].y1;
+                    const double y2 = ends[k - 1].y2;
+                    starts[k].y1 = y1;
+                    starts[k].y2 = y2;
+                    if (k + 1 < segments)
+                    {
+                        ends[k].y1 += transfer_[0][0] * y1 + transfer_[0][1] * y2;
+                        ends[k].y2 += transfer_[1][0] * y1 + transfer_[1][1] * y2;
+                    }
+                }
+
+                // 3. Add each inherited state's zero-input response and write back
+                pool_.parallel_for(segments, [&](size_t k)
+                {
+                    const size_t first = k * segment_length;
+                    const size_t count = std::min(segment_length, num_samples - first);
+                    const size_t corrected = k == 0 ? 0 : std::min(count, response_length_);
+                    const double y1 = starts[k].y1;
+                    const double y2 = starts[k].y2;
+                    const double *in = output_.data() + first;
+                    SampleType *out = data + first;
+
+                    size_t n = 0;
+                    for (; n < corrected; ++n)
+                    {
+                        out[n] = simd::saturate_cast<SampleType>(in[n] + y1 * response_y1_[n] + y2 * response_y2_[n]);
+                    }
+                    for (; n < count; ++n)
+                    {
+                        out[n] = simd::saturate_cast<SampleType>(in[n]);
+                    }
+                });
+
+                // Carried state: true output of the final segment
+                const size_t last_first = (segments - 1) * segment_length;
+                const size_t last_count = num_samples - last_first;
+                state_.x1 = last_x1;
+                state_.x2 = last_x2;
+                state_.y1 = ends[segments - 1].y1 + zero_input(last_count - 1, starts[segments - 1]);
+                state_.y2 = ends[segments - 1].y2 + zero_input(last_count - 2, starts[segments - 1]);
+            }
+
+        private:
+            // Plain DF1 in double, the reference BiquadFilter computes
+            template <typename Output>
+            void run_segment(const SampleType *input, Output *output, size_t count, BiquadState &s) const
+            {
+                const double b0 = coeffs_.b0, b1 = coeffs_.b1, b2 = coeffs_.b2;
+                const double a1 = coeffs_.a1, a2 = coeffs_.a2;
+                double x1 = s.x1, x2 = s.x2, y1 = s.y1, y2 = s.y2;
+
+                for (size_t n = 0; n < count; ++n)
+                {
+                    const double x = static_cast<double>(input[n]);
+                    const double y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+                    x2 = x1;
+                    x1 = x;
+                    y2 = y1;
+                    y1 = y;
+                    output[n] = simd::saturate_cast<Output>(y);
+                }
+
+                s = {x1, x2, y1, y2};
+            }
+
+            // Zero-input response at sample n of a segment starting from s
+            double zero_input(size_t n, const BiquadState &s) const
+            {
+                if (n >= response_length_)
+                {
+                    return transfer_at(n, s);
+                }
+                return s.y1 * response_y1_[n] + s.y2 * response_y2_[n];
+            }
+
+            // Slow path for n past the stored (negligible) responses
+            double transfer_at(size_t n, const BiquadState &s) const
+            {
+                double m[2][2];
+                companion_power(n + 1, m);
+                return m[0][0] * s.y1 + m[0][1] * s.y2;
+            }
+
+            /**
+             * Zero-input responses to unit y[-1] / y[-2], stored until they
+             * decay below double resolution, and the segment transfer matrix
+             */
+            void prepare_responses(size_t segment_length)
+            {
+                if (cached_segment_length_ == segment_length)
+                    return;
+
+                response_y1_.clear();
+                response_y2_.clear();
+
+                // State (y[n-1], y[n-2]) for each unit initial condition
+                double p1 = 1.0, p2 = 0.0;
+                double q1 = 0.0, q2 = 1.0;
+                for (size_t n = 0; n < segment_length; ++n)
+                {
+                    const double p = -coeffs_.a1 * p1 - coeffs_.a2 * p2;
+                    const double q = -coeffs_.a1 * q1 - coeffs_.a2 * q2;
+                    response_y1_.push_back(p);
+                    response_y2_.push_back(q);
+                    p2 = p1;
+                    p1 = p;
+                    q2 = q1;
+                    q1 = q;
+
+                    if (std::abs(p1) + std::abs(p2) + std::abs(q1) + std::abs(q2) < 1e-17)
+                        break;
+                }
+                response_length_ = response_y1_.size();
+
+                // State after a full segment: (y[L-1], y[L-2]) = A^L (y[-1], y[-2])
+                companion_power(segment_length, transfer_);
+                cached_segment_length_ = segment_length;
+            }
+
+            // A^n for the companion matrix A = [[-a1, -a2], [1, 0]]
+            void companion_power(size_t n, double (&result)[2][2]) const
+            {
+                double base[2][2] = {{-coeffs_.a1, -coeffs_.a2}, {1.0, 0.0}};
+                double acc[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
+
+                auto multiply = [](const double (&a)[2][2], const double (&b)[2][2], double (&out)[2][2])
+                {
+                    double tmp[2][2];
+                    for (size_t i = 0; i < 2; ++i)
+                    {
+                        for (size_t j = 0; j < 2; ++j)
+                        {
+                            tmp[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j];
+                        }
+                    }
+                    std::memcpy(out, tmp, sizeof(tmp));
+                };
+
+                for (; n > 0; n >>= 1)
+                {
+                    if (n & 1)
+                    {
+                        multiply(acc, base, acc);
+                    }
+                    multiply(base, base, base);
+                }
+                std::memcpy(result, acc, sizeof(acc));
+            }
+
+            ThreadPool &pool_;
+            BiquadCoefficients coeffs_;
+            BiquadState state_;
+
+            std::vector<double> response_y1_;
+            std::vector<double> response_y2_;
+            size_t response_length_ = 0;
+            double transfer_[2][2] = {};
+            size_t cached_segment_length_ = 0;
+            std::vector<double> output_; // Unrounded output of the parallel passes
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,357 @@
+#pragma once
+
+#include "project.h"
+#include "DSP/FIRDesign.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+#include <numeric>
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Resampler quality presets
+         * Longer kernels give a narrower transition band and deeper stopband.
+         */
+        enum class ResamplerQuality
+        {
+            Draft,    // 16 taps, ~55 dB stopband
+            Standard, // 48 taps, ~80 dB stopband
+            High      // 96 taps, ~100 dB stopband
+        };
+
+        /**
+         * Polyphase windowed-sinc sample-rate converter for interleaved streams
+         *
+         * A Kaiser-windowed sinc kernel is tabulated at num_phases()
+         * sub-sample offsets. When both rates are whole numbers the ratio is
+         * reduced to L/M and the table has exactly L phases, so every output
+         * lands on a row (exact rational conversion, e.g. 160/147 for 44.1 to
+         * 48 kHz). Otherwise, or after set_ratio(), outputs interpolate
+         * linearly between the two nearest rows, which allows any ratio and
+         * smooth ratio changes (varispeed, clock-drift correction).
+         *
+         * The cutoff sits below the lower of the two Nyquist frequencies and
+         * the kernel widens with the downsampling factor, so the transition
+         * band stays the same fraction of the output band. Inner products
+         * use eight partial sums so the compiler vectorises them.
+         *
+         * Output is time-aligned with the input (output k is input time
+         * k * input_rate / output_rate). To do that the resampler holds back
+         * latency() input frames of lookahead; flush() drains them at the
+         * end of a stream.
+         */
+        template <typename SampleType>
+        class Resampler
+        {
+        public:
+            using value_type = simd::compute_t<SampleType>;
+
+            /// Largest L used for exact rational conversion
+            static constexpr size_t max_rational_phases = 4096;
+
+            /**
+             * @param input_rate Input sample rate in Hz
+             * @param output_rate Output sample rate in Hz
+             * @param num_channels Interleaved channels per frame
+             */
+            Resampler(double input_rate, double output_rate, size_t num_channels,
+                      ResamplerQuality quality = ResamplerQuality::Standard)
+                : num_channels_(num_channels), quality_(quality)
+            {
+                if (input_rate <= 0.0 || output_rate <= 0.0)
+                {
+                    throw std::invalid_argument("Sample rates must be positive");
+                }
+                if (num_channels == 0)
+                {
+                    throw std::invalid_argument("Resampler needs at least one channel");
+                }
+
+                // Anti-aliasing follows the nominal ratio for the resampler's lifetime
+                scale_ = std::min(1.0, output_rate / input_rate);
+                step_ = input_rate / output_rate;
+
+                size_t phases = variable_phases();
+                if (is_whole(input_rate) && is_whole(output_rate))
+                {
+                    const auto in = static_cast<uint64_t>(std::llround(input_rate));
+                    const auto out = static_cast<uint64_t>(std::llround(output_rate));
+                    const uint64_t g = std::gcd(in, out);
+                    if (out / g <= max_rational_phases)
+                    {
+                        up_ = static_cast<size_t>(out / g);
+                        down_ = static_cast<size_t>(in / g);
+                        phases = up_;
+                    }
+                }
+
+                build_table(phases);
+                history_.resize(num_channels_);
+                reset();
+            }
+
+            /**
+             * Change the conversion ratio (output rate / input rate)
+             * Takes effect from the next output and switches to
+             * interpolated phases. The filter cutoff keeps the nominal
+             * ratio, so stay within a few percent of it.
+             */
+            void set_ratio(double ratio)
+            {
+                if (ratio <= 0.0)
+                {
+                    throw std::invalid_argument("Resampling ratio must be positive");
+                }
+
+                if (is_rational())
+                {
+                    frac_ = static_cast<double>(phase_) / static_cast<double>(up_);
+                    up_ = down_ = 0;
+                    if (phases_ < variable_phases())
+                    {
+                        build_table(variable_phases());
+                    }
+                }
+                step_ = 1.0 / ratio;
+            }
+
+            double ratio() const { return 1.0 / step_; }
+
+            /// True while converting by an exact L/M ratio
+            bool is_rational() const { return up_ != 0; }
+
+            size_t num_phases() const { return phases_; }
+            size_t taps_per_phase() const { return taps_; }
+            size_t num_channels() const { return num_channels_; }
+
+            /// Input frames held back as lookahead
+            size_t latency() const { return taps_ / 2; }
+
+            /**
+             * Upper bound on frames the next process() call can produce
+             */
+            size_t max_output_frames(size_t input_frames) const
+            {
+                const double available = static_cast<double>(history_[0].size() + input_frames) - static_cast<double>(taps_ / 2 + 1);
+                const double position = static_cast<double>(position_) + current_fraction();
+                if (available < position)
+                {
+                    return 0;
+                }
+                return static_cast<size_t>((available - position) / step_) + 2;
+            }
+
+            /**
+             * Convert a block of interleaved frames
+             * All input is consumed; outputs that do not fit in
+             * output_capacity stay pending for the next call.
+             * @return Frames written to output
+             */
+            size_t process(const SampleType *input, size_t input_frames, SampleType *output, size_t output_capacity)
+            {
+                for (size_t ch = 0; ch < num_channels_; ++ch)
+                {
+                    auto &history = history_[ch];
+                    const size_t old_size = history.size();
+                    history.resize(old_size + input_frames);
+                    for (size_t i = 0; i < input_frames; ++i)
+                    {
+                        history[old_size + i] = static_cast<value_type>(input[i * num_channels_ + ch]);
+                    }
+                }
+
+                const size_t lookbehind = taps_ / 2 - 1;
+                const size_t available = history_[0].size();
+                size_t written = 0;
+
+                while (written < output_capacity && position_ + taps_ / 2 + 1 <= available)
+                {
+                    const size_t start = position_ - lookbehind;
+                    SampleType *frame = output + written * num_channels_;
+
+                    if (is_rational())
+                    {
+                        const value_type *row = table_.data() + phase_ * taps_;
+                        for (size_t ch = 0; ch < num_channels_; ++ch)
+                        {
+                            frame[ch] = simd::saturate_cast<SampleType>(dot(row, history_[ch].data() + start, taps_));
+                        }
+
+                        phase_ += down_;
+                        position_ += phase_ / up_;
+                        phase_ %= up_;
+                    }
+                    else
+                    {
+                        const double scaled = frac_ * static_cast<double>(phases_);
+                        const size_t p = std::min(static_cast<size_t>(scaled), phases_ - 1);
+                        const auto t = static_cast<value_type>(scaled - static_cast<double>(p));
+                        const value_type *row = table_.data() + p * taps_;
+
+                        for (size_t ch = 0; ch < num_channels_; ++ch)
+                        {
+                            const value_type *x = history_[ch].data() + start;
+                            const value_type a = dot(row, x, taps_);
+                            const value_type b = dot(row + taps_, x, taps_);
+                            frame[ch] = simd::saturate_cast<SampleType>(a + t * (b - a));
+                        }
+
+                        frac_ += step_;
+                        const double whole = std::floor(frac_);
+                        position_ += static_cast<size_t>(whole);
+                        frac_ -= whole;
+                    }
+                    ++written;
+                }
+
+                // Drop input that no future output can reach
+                const size_t drop = std::min(position_ - lookbehind, available);
+                for (auto &history : history_)
+                {
+                    history.erase(history.begin(), history.begin() + drop);
+                }
+                position_ -= drop;
+
+                return written;
+            }
+
+            /**
+             * Drain the lookahead at the end of a stream
+             * Outputs up to the last real input frame; call reset() before
+             * starting a new stream.
+             */
+            size_t flush(SampleType *output, size_t output_capacity)
+            {
+                const std::vector<SampleType> silence(latency() * num_channels_, SampleType(0));
+                return process(silence.data(), latency(), output, output_capacity);
+            }
+
+            // Clear history and restart at phase zero
+            void reset()
+            {
+                for (auto &history : history_)
+                {
+                    history.assign(taps_ / 2 - 1, value_type(0));
+                }
+                position_ = taps_ / 2 - 1;
+                phase_ = 0;
+                frac_ = 0.0;
+            }
+
+        private:
+            struct Preset
+            {
+                size_t taps;
+                double beta;
+                size_t phases; // Interpolated mode
+            };
+
+            Preset preset() const
+            {
+                switch (quality_)
+                {
+                case ResamplerQuality::Draft:
+                    return {16, 5.0, 128};
+                case ResamplerQuality::High:
+                    return {96, 10.0, 1024};
+                default:
+                    return {48, 8.0, 256};
+                }
+            }
+
+            size_t variable_phases() const { return preset().phases; }
+
+            static bool is_whole(double rate)
+            {
+                return std::abs(rate - std::round(rate)) < 1e-9;
+            }
+
+            double current_fraction() const
+            {
+                return is_rational() ? static_cast<double>(phase_) / static_cast<double>(up_) : frac_;
+            }
+
+            /**
+             * Tabulate phases + 1 rows (the last is phase 0 one sample later,
+             * for interpolation). Row p holds the kernel at offset p / phases,
+             * aligned with history[position - taps/2 + 1 ...].
+             */
+            void build_table(size_t phases)
+            {
+                const Preset p = preset();
+
+                // Widen the kernel by the downsampling factor; multiple of 8 for the dot kernel
+                const auto taps = static_cast<size_t>(std::ceil(static_cast<double>(p.taps) / scale_));
+                taps_ = (taps + 7) / 8 * 8;
+                phases_ = phases;
+
+                // Kaiser estimate of stopband depth and transition width
+                const double attenuation = p.beta / 0.1102 + 8.7;
+                const double transition = (attenuation - 7.95) / (2.285 * TWO_PI * static_cast<double>(taps_));
+                const double cutoff = std::max(0.05 * scale_, 0.5 * scale_ - transition / 2.0);
+
+                const double half = static_cast<double>(taps_) / 2.0;
+                const double lookbehind = half - 1.0;
+                const double denom = FIRDesign::bessel_i0(p.beta);
+
+                table_.assign((phases_ + 1) * taps_, value_type(0));
+                std::vector<double> row(taps_);
+                for (size_t phase = 0; phase <= phases_; ++phase)
+                {
+                    const double offset = static_cast<double>(phase) / static_cast<double>(phases_);
+                    double sum = 0.0;
+                    for (size_t j = 0; j < taps_; ++j)
+                    {
+                        const double t = offset + lookbehind - static_cast<double>(j);
+                        const double r = t / half;
+                        const double window = std::abs(r) >= 1.0 ? 0.0 : FIRDesign::bessel_i0(p.beta * std::sqrt(1.0 - r * r)) / denom;
+                        const double sinc = t == 0.0 ? 2.0 * cutoff : std::sin(TWO_PI * cutoff * t) / (PI * t);
+                        row[j] = sinc * window;
+                        sum += row[j];
+                    }
+
+                    // Unity DC gain at every phase
+                    for (size_t j = 0; j < taps_; ++j)
+                    {
+                        table_[phase * taps_ + j] = static_cast<value_type>(row[j] / sum);
+                    }
+                }
+            }
+
+            // Eight partial sums: independent lanes the compiler can vectorise
+            static value_type dot(const value_type *AUDIO_RESTRICT a, const value_type *AUDIO_RESTRICT b, size_t n)
+            {
+                value_type acc[8] = {};
+                for (size_t j = 0; j < n; j += 8)
+                {
+                    for (size_t k = 0; k < 8; ++k)
+                    {
+                        acc[k] += a[j + k] * b[j + k];
+                    }
+                }
+                return ((acc[0] + acc[4]) + (acc[1] + acc[5])) + ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+            }
+
+            size_t num_channels_;
+            ResamplerQuality quality_;
+
+            double scale_ = 1.0; // min(1, output / input) at construction
+            double step_ = 1.0;  // Input samples per output sample
+            size_t up_ = 0;      // L and M of an exact ratio (0 when interpolating)
+            size_t down_ = 0;
+
+            size_t taps_ = 0;
+            size_t phases_ = 0;
+            std::vector<value_type> table_; // (phases_ + 1) rows of taps_
+
+            std::vector<std::vector<value_type>> history_; // Per channel, from position_ - taps/2 + 1
+            size_t position_ = 0; // Index in history of the input sample at or before the output time
+            size_t phase_ = 0;    // Rational mode: offset in units of 1/L
+            double frac_ = 0.0;   // Interpolated mode: offset in [0, 1)
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,343 @@
+#pragma once
+
+#include "project.h"
+#include "ChannelDispatch.hpp"
+#include "DSP/Denormals.hpp"
+#include "DSP/FastMath.hpp"
+#include "DSP/FilterDesign.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /// Response taken from the state-variable filter's outputs
+        enum class SVFMode
+        {
+            Lowpass,
+            Highpass,
+            Bandpass,
+            Notch,
+            Peak,
+            Allpass,
+            LowShelf,
+            HighShelf,
+            Bell
+        };
+
+        /**
+         * Every response of one state-variable filter tick at the set cutoff and Q
+         * Shelves and bell move the poles with the gain, so they are modes only.
+         */
+        template <typename T>
+        struct SVFOutputs
+        {
+            T lowpass;
+            T bandpass; // Unity gain at the cutoff
+            T highpass;
+            T notch;
+            T peak;
+            T allpass;
+        };
+
+        /**
+         * Topology-preserving transform (TPT) state-variable filter
+         *
+         * The analog SVF is discretised with trapezoidal integrators and the
+         * zero-delay feedback loop solved exactly (Zavalishin/Simper form),
+         * so the state stays meaningful when the cutoff moves: there is no
+         * coefficient-dependent state to zipper or blow up, and per-sample
+         * modulation is stable at any rate. A new cutoff costs one tan
+         * (polynomial FastMath::tan) and a division; Q and the mode are
+         * independent of it.
+         *
+         * The pass and notch responses come from the same two integrator
+         * states, so process_all() returns them all from one tick. Shelves
+         * and bell use Simper's forms with A = 10^(dB/40): the shelves scale
+         * g by 1/sqrt(A) or sqrt(A), the bell damps with k = 1/(Q A), so they
+         * match FilterDesign::low_shelf() / high_shelf() (slope 1 at
+         * Q = 1/sqrt(2)) and peaking_eq(). The buffer paths mix the selected
+         * mode as m0 * x + m1 * band + m2 * low and run up to max_lanes
+         * channels side by side, like BiquadFilter.
+         */
+        template <typename SampleType>
+        class StateVariableFilter
+        {
+        public:
+            using value_type = simd::compute_t<SampleType>;
+
+            /// Channels processed together per sweep over interleaved frames
+            static constexpr size_t max_lanes = 8;
+
+            explicit StateVariableFilter(double sample_rate, double cutoff_freq = 1000.0, double q = 0.707,
+                                         SVFMode mode = SVFMode::Lowpass)
+                : sample_rate_(sample_rate), mode_(mode)
+            {
+                if (sample_rate <= 0.0)
+                {
+                    throw std::invalid_argument("Sample rate must be positive");
+                }
+                set_q(q);
+                set_cutoff(cutoff_freq);
+            }
+
+            /**
+             * Set the cutoff (centre frequency for band modes)
+             * Cheap enough to call every sample; clamped below Nyquist.
+             */
+            void set_cutoff(double freq)
+            {
+                cutoff_ = freq;
+                g_ = prewarp(freq);
+                update_mix();
+            }
+
+            void set_q(double q)
+            {
+                if (q <= 0.0)
+                {
+                    throw std::invalid_argument("Q must be positive");
+                }
+                q_ = q;
+                k_ = 1.0 / q;
+                update_mix();
+            }
+
+            // Gain of the shelf and bell modes
+            void set_gain_db(double gain_db)
+            {
+                gain_db_ = gain_db;
+                gain_ = std::pow(10.0, gain_db / 40.0);
+                update_mix();
+            }
+
+            void set_mode(SVFMode mode)
+            {
+                mode_ = mode;
+                update_mix();
+            }
+
+            double cutoff() const { return cutoff_; }
+            double q() const { return q_; }
+            double gain_db() const { return gain_db_; }
+            SVFMode mode() const { return mode_; }
+
+            // Allocate state for num_channels up front (processing then never allocates)
+            void prepare(size_t num_channels)
+            {
+                if (num_channels > ic1_.size())
+                {
+                    ic1_.resize(num_channels, value_type(0));
+                    ic2_.resize(num_channels, value_type(0));
+                }
+            }
+
+            // One tick for one channel, every response at once
+            SVFOutputs<value_type> process_all(value_type input, size_t channel = 0)
+            {
+                prepare(channel + 1);
+
+                const Tick t = tick(coefficients(g_, k_), input, ic1_[channel], ic2_[channel]);
+                const auto k = static_cast<value_type>(k_);
+                const value_type high = input - k * t.band - t.low;
+
+                return {t.low, k * t.band, high, input - k * t.band, t.low - high, input - value_type(2) * k * t.band};
+            }
+
+            // One tick for one channel, selected mode
+            SampleType process_sample(SampleType input, size_t channel = 0)
+            {
+                prepare(channel + 1);
+
+                const auto x = static_cast<value_type>(input);
+                const Tick t = tick(mode_coefficients(g_), x, ic1_[channel], ic2_[channel]);
+                return simd::saturate_cast<SampleType>(mix_[0] * x + mix_[1] * t.band + mix_[2] * t.low);
+            }
+
+            // Process entire buffer (interleaved stereo/mono) at the current cutoff
+            void process_buffer(SampleType *buffer, size_t num_samples, size_t num_channels)
+            {
+                process_frames(buffer, num_samples, num_channels, nullptr);
+            }
+
+            /**
+             * Process with a cutoff per frame (LFO, envelope follower, ...)
+             * @param cutoff_freqs num_samples cutoff values in Hz; the last
+             *                     one stays in effect afterwards
+             */
+            void process_buffer(SampleType *buffer, size_t num_samples, size_t num_channels, const double *cutoff_freqs)
+            {
+                process_frames(buffer, num_samples, num_channels, cutoff_freqs);
+                if (num_samples > 0)
+                {
+                    set_cutoff(cutoff_freqs[num_samples - 1]);
+                }
+            }
+
+            // Reset filter state (clear integrators)
+            void reset()
+            {
+                std::fill(ic1_.begin(), ic1_.end(), value_type(0));
+                std::fill(ic2_.begin(), ic2_.end(), value_type(0));
+            }
+
+        private:
+            // Zero-delay feedback solution for one integrator gain g
+            struct Coefficients
+            {
+                value_type a1, a2, a3;
+            };
+
+            struct Tick
+            {
+                value_type band, low;
+            };
+
+            double prewarp(double freq) const
+            {
+                const double normalised = std::clamp(freq / sample_rate_, 0.0, 0.49);
+                return FastMath::tan(PI * normalised);
+            }
+
+            static Coefficients coefficients(double g, double k)
+            {
+                const double a1 = 1.0 / (1.0 + g * (g + k));
+                return {static_cast<value_type>(a1), static_cast<value_type>(g * a1), static_cast<value_type>(g * g * a1)};
+            }
+
+            // Integrator gain and damping of the selected mode
+            Coefficients mode_coefficients(double g) const
+            {
+                return coefficients(g * g_scale_, damping_);
+            }
+
+            static Tick tick(const Coefficients &c, value_type x, value_type &ic1, value_type &ic2)
+            {
+                const value_type v3 = x - ic2;
+                const value_type v1 = c.a1 * ic1 + c.a2 * v3;
+                const value_type v2 = ic2 + c.a2 * ic1 + c.a3 * v3;
+                ic1 = flush_denormal(value_type(2) * v1 - ic1);
+                ic2 = flush_denormal(value_type(2) * v2 - ic2);
+                return {v1, v2};
+            }
+
+            // Output = m0 * x + m1 * band + m2 * low (high = x - k * band - low)
+            void update_mix()
+            {
+                const double k = k_;
+                const double A = gain_;
+                double m0 = 0.0, m1 = 0.0, m2 = 0.0;
+                g_scale_ = 1.0;
+                damping_ = k;
+                switch (mode_)
+                {
+                case SVFMode::Lowpass:
+                    m2 = 1.0;
+                    break;
+                case SVFMode::Highpass:
+                    m0 = 1.0, m1 = -k, m2 = -1.0;
+                    break;
+                case SVFMode::Bandpass:
+                    m1 = k;
+                    break;
+                case SVFMode::Notch:
+                    m0 = 1.0, m1 = -k;
+                    break;
+                case SVFMode::Peak:
+                    m0 = -1.0, m1 = k, m2 = 2.0;
+                    break;
+                case SVFMode::Allpass:
+                    m0 = 1.0, m1 = -2.0 * k;
+                    break;
+                case SVFMode::LowShelf:
+                    g_scale_ = 1.0 / std::sqrt(A);
+                    m0 = 1.0, m1 = k * (A - 1.0), m2 = A * A - 1.0;
+                    break;
+                case SVFMode::HighShelf:
+                    g_scale_ = std::sqrt(A);
+                    m0 = A * A, m1 = k * (1.0 - A) * A, m2 = 1.0 - A * A;
+                    break;
+                case SVFMode::Bell:
+                    damping_ = k / A;
+                    m0 = 1.0, m1 = damping_ * (A * A - 1.0);
+                    break;
+                }
+                mix_ = {static_cast<value_type>(m0), static_cast<value_type>(m1), static_cast<value_type>(m2)};
+            }
+
+            void process_frames(SampleType *buffer, size_t num_samples, size_t num_channels, const double *cutoff_freqs)
+            {
+                if (num_samples == 0 || num_channels == 0)
+                    return;
+
+                prepare(num_channels);
+
+                for_each_lane_group<max_lanes>(num_channels, [&](auto lanes, size_t first)
+                {
+                    process_lanes<decltype(lanes)::value>(buffer, num_samples, num_channels, first, cutoff_freqs);
+                });
+            }
+
+            /**
+             * Sweep all frames for channels [first, first + Lanes)
+             * Integrator states stay in lane arrays for the whole sweep; a
+             * modulated sweep recomputes the shared coefficients per frame.
+             */
+            template <size_t Lanes>
+            void process_lanes(SampleType *buffer, size_t num_samples, size_t stride, size_t first, const double *cutoff_freqs)
+            {
+                value_type ic1[Lanes], ic2[Lanes];
+                for (size_t lane = 0; lane < Lanes; ++lane)
+                {
+                    ic1[lane] = ic1_[first + lane];
+                    ic2[lane] = ic2_[first + lane];
+                }
+
+                Coefficients c = mode_coefficients(g_);
+                const value_type m0 = mix_[0], m1 = mix_[1], m2 = mix_[2];
+
+                for (size_t sample = 0; sample < num_samples; ++sample)
+                {
+                    if (cutoff_freqs != nullptr)
+                    {
+                        c = mode_coefficients(prewarp(cutoff_freqs[sample]));
+                    }
+
+                    SampleType *frame = buffer + sample * stride + first;
+                    AUDIO_SIMD_LANES
+                    for (size_t lane = 0; lane < Lanes; ++lane)
+                    {
+                        const auto x = static_cast<value_type>(frame[lane]);
+                        const Tick t = tick(c, x, ic1[lane], ic2[lane]);
+                        frame[lane] = simd::saturate_cast<SampleType>(m0 * x + m1 * t.band + m2 * t.low);
+                    }
+                }
+
+                for (size_t lane = 0; lane < Lanes; ++lane)
+                {
+                    ic1_[first + lane] = ic1[lane];
+                    ic2_[first + lane] = ic2[lane];
+                }
+            }
+
+            double sample_rate_;
+            double cutoff_ = 1000.0;
+            double q_ = 0.707;
+            double gain_db_ = 0.0;
+            SVFMode mode_;
+
+            double g_ = 0.0;         // tan(pi * fc / fs)
+            double k_ = 1.414;       // 1 / Q
+            double gain_ = 1.0;      // A = 10^(dB/40), square root of the linear gain
+            double g_scale_ = 1.0;   // Mode's factor on g (shelves)
+            double damping_ = 1.414; // Mode's damping (bell: k / A)
+            std::array<value_type, 3> mix_{};
+
+            // Integrator states per channel
+            std::vector<value_type> ic1_;
+            std::vector<value_type> ic2_;
+        };
+
+    } // namespace dsp
+} // namespace audio
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "project.h"
+#include "ThreadPool.hpp"
+#include "DSP/BiquadCascade.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace dsp
+    {
+
+        /**
+         * Offline zero-phase (forward-backward, "filtfilt") filtering
+         *
+         * The sections run over the signal forwards, then over the result
+         * backwards, so phase shifts cancel and the magnitude response is
+         * squared (a -3 dB cutoff becomes -6 dB, 12 dB/oct becomes 24).
+         *
+         * Edge transients are suppressed the usual way: the channel is
+         * extended at both ends by an odd reflection about its end samples,
+         * and each pass starts from the steady state for a constant input
+         * equal to its first sample. The whole channel is filtered in one
+         * go, so this is not a streaming processor.
+         *
+         * Each channel is copied out into a contiguous work array in the
+         * policy's precision and streamed through the cascade in L1-sized
+         * blocks; channels run concurrently on the thread pool.
+         */
+        template <typename SampleType, typename Policy = DoubleDF1>
+        class ZeroPhaseFilter
+        {
+        public:
+            using value_type = typename Policy::value_type;
+
+            explicit ZeroPhaseFilter(const BiquadCoefficients &coeffs, ThreadPool &pool = ThreadPool::shared())
+                : ZeroPhaseFilter(std::vector<BiquadCoefficients>{coeffs}, pool)
+            {
+            }
+
+            explicit ZeroPhaseFilter(const std::vector<BiquadCoefficients> &sections, ThreadPool &pool = ThreadPool::shared())
+                : pool_(pool)
+            {
+                set_sections(sections);
+            }
+
+            // Zero-phase version of an existing filter or cascade (enabled sections only)
+            template <typename S, typename P>
+            explicit ZeroPhaseFilter(const BiquadFilter<S, P> &filter, ThreadPool &pool = ThreadPool::shared())
+                : ZeroPhaseFilter(filter.coefficients(), pool)
+            {
+            }
+
+            template <typename S, typename P>
+            explicit ZeroPhaseFilter(const BiquadCascade<S, P> &cascade, ThreadPool &pool = ThreadPool::shared())
+                : pool_(pool)
+            {
+                std::vector<BiquadCoefficients> sections;
+                for (size_t i = 0; i < cascade.num_sections(); ++i)
+                {
+                    if (cascade.is_section_enabled(i))
+                    {
+                        sections.push_back(cascade.section(i));
+                    }
+                }
+                set_sections(sections);
+            }
+
+            void set_sections(const std::vector<BiquadCoefficients> &sections)
+            {
+                sections_ = sections;
+                for (auto &coeffs : sections_)
+                {
+                    coeffs.normalize();
+                }
+            }
+
+            const std::vector<BiquadCoefficients> &sections() const { return sections_; }
+
+            /**
+             * Samples of odd reflection added at each end
+             * 0 (the default) picks 3 * (2 * num_sections + 1); longer
+             * padding helps filters with slowly decaying responses.
+             */
+            void set_padding(size_t padding) { padding_ = padding; }
+
+            size_t padding() const
+            {
+                return padding_ != 0 ? padding_ : 3 * (2 * sections_.size() + 1);
+            }
+
+            /**
+             * Filter an entire interleaved signal in place
+             * Padding is shortened for signals of padding() samples or less.
+             */
+            void process_buffer(SampleType *buffer, size_t num_samples, size_t num_channels)
+            {
+                if (num_samples == 0 || num_channels == 0 || sections_.empty())
+                    return;
+
+                pool_.parallel_for(num_channels, [&](size_t ch)
+                                   { process_channel(buffer, num_samples, num_channels, ch); });
+            }
+
+        private:
+            void process_channel(SampleType *buffer, size_t num_samples, size_t num_channels, size_t channel) const
+            {
+                const size_t pad = std::min(padding(), num_samples - 1);
+                const size_t length = num_samples + 2 * pad;
+
+                std::vector<value_type> work(length);
+                for (size_t i = 0; i < num_samples; ++i)
+                {
+                    work[pad + i] = static_cast<value_type>(buffer[i * num_channels + channel]);
+                }
+
+                // Odd reflection: the extension continues the edge slope
+                const value_type first = work[pad];
+                const value_type last = work[pad + num_samples - 1];
+                for (size_t i = 0; i < pad; ++i)
+                {
+                    work[pad - 1 - i] = value_type(2) * first - work[pad + 1 + i];
+                    work[pad + num_samples + i] = value_type(2) * last - work[pad + num_samples - 2 - i];
+                }
+
+                BiquadCascade<value_type, Policy> cascade(sections_);
+
+                filter_pass(cascade, work);
+                std::reverse(work.begin(), work.end());
+                filter_pass(cascade, work);
+                std::reverse(work.begin(), work.end());
+
+                for (size_t i = 0; i < num_samples; ++i)
+                {
+                    buffer[i * num_channels + channel] = simd::saturate_cast<SampleType>(work[pad + i]);
+                }
+            }
+
+            // One forward pass starting in steady state for a constant work[0]
+            void filter_pass(BiquadCascade<value_type, Policy> &cascade, std::vector<value_type> &work) const
+            {
+                double level = static_cast<double>(work.front());
+                for (size_t i = 0; i < sections_.size(); ++i)
+                {
+                    const BiquadCoefficients &c = sections_[i];
+                    const double denom = 1.0 + c.a1 + c.a2;
+                    const double output = std::abs(denom) > 1e-12 ? level * (c.b0 + c.b1 + c.b2) / denom : 0.0;
+
+                    cascade.set_section_state(i, 0, {level, level, output, output});
+                    level = output;
+                }
+                cascade.process_buffer(work.data(), work.size(), 1);
+            }
+
+            ThreadPool &pool_;
+            std::vector<BiquadCoefficients> sections_;
+            size_t padding_ = 0;
+        };
+
+    } // namespace dsp
+} // namespace audio
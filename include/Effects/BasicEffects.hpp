@@ -27,13 +27,7 @@ namespace audio
                     return; // No-op if gain is 1.0
                 }
 
-                SampleType *data = buffer.data();
-                size_t total = buffer.total_samples();
-
-                for (size_t i = 0; i < total; ++i)
-                {
-                    data[i] = static_cast<SampleType>(data[i] * gain_);
-                }
+                simd::apply_gain(buffer.data(), buffer.total_samples(), gain_);
             }
 
             void reset() override
@@ -93,18 +87,17 @@ namespace audio
                 if (!this->is_enabled())
                     return;
 
+                // Linear ramp over the fade region, constant end gain after it
                 size_t num_samples = buffer.num_samples();
-                size_t num_channels = buffer.num_channels();
+                size_t ramp_samples = std::min(num_samples, fade_samples_);
 
-                for (size_t sample = 0; sample < num_samples; ++sample)
-                {
-                    float gain = calculate_gain_at_sample(sample);
+                simd::apply_gain_ramp(buffer.data(), ramp_samples, buffer.num_channels(),
+                                      start_gain_, calculate_gain_at_sample(ramp_samples));
 
-                    for (size_t ch = 0; ch < num_channels; ++ch)
-                    {
-                        buffer(sample, ch) = static_cast<SampleType>(
-                            buffer(sample, ch) * gain);
-                    }
+                if (ramp_samples < num_samples)
+                {
+                    simd::apply_gain(buffer.data() + ramp_samples * buffer.num_channels(),
+                                     (num_samples - ramp_samples) * buffer.num_channels(), end_gain_);
                 }
             }
 
@@ -247,25 +240,15 @@ namespace audio
                 }
 
                 size_t total = dest.total_samples();
-                SampleType *dest_data = dest.data();
-                const SampleType *src_data = source.data();
 
                 switch (mode_)
                 {
                 case MixMode::Add:
-                    for (size_t i = 0; i < total; ++i)
-                    {
-                        dest_data[i] = static_cast<SampleType>(
-                            dest_data[i] + src_data[i] * mix_gain_);
-                    }
+                    simd::mix(dest.data(), source.data(), total, mix_gain_);
                     break;
 
                 case MixMode::Average:
-                    for (size_t i = 0; i < total; ++i)
-                    {
-                        dest_data[i] = static_cast<SampleType>(
-                            (dest_data[i] + src_data[i] * mix_gain_) * 0.5f);
-                    }
+                    simd::mix_scaled(dest.data(), source.data(), total, mix_gain_, 0.5f);
                     break;
 
                 default:
@@ -291,16 +274,12 @@ namespace audio
             void convert_stereo_to_mono(AudioBuffer<SampleType> &buffer)
             {
                 // Average left and right channels
-                size_t num_samples = buffer.num_samples();
-
-                for (size_t i = 0; i < num_samples; ++i)
+                for (auto frame : buffer.frames())
                 {
-                    SampleType left = buffer(i, 0);
-                    SampleType right = buffer(i, 1);
-                    SampleType mono = static_cast<SampleType>((left + right) * 0.5f);
+                    SampleType mono = static_cast<SampleType>((frame[0] + frame[1]) * 0.5f);
 
-                    buffer(i, 0) = mono;
-                    buffer(i, 1) = mono; // Keep stereo format but with identical channels
+                    frame[0] = mono;
+                    frame[1] = mono; // Keep stereo format but with identical channels
                 }
             }
 
@@ -341,15 +320,10 @@ namespace audio
                     return; // Only works on stereo
                 }
 
-                size_t num_samples = buffer.num_samples();
-
-                for (size_t i = 0; i < num_samples; ++i)
+                for (auto frame : buffer.frames())
                 {
-                    SampleType left = buffer(i, 0);
-                    SampleType right = buffer(i, 1);
-
-                    buffer(i, 0) = static_cast<SampleType>(left * left_gain_);
-                    buffer(i, 1) = static_cast<SampleType>(right * right_gain_);
+                    frame[0] = static_cast<SampleType>(frame[0] * left_gain_);
+                    frame[1] = static_cast<SampleType>(frame[1] * right_gain_);
                 }
             }
 
@@ -0,0 +1,277 @@
+#pragma once
+
+#include "project.h"
+#include "AudioBuffer.hpp"
+#include "ThreadPool.hpp"
+#include "Effects/AudioEffect.hpp"
+#include "DSP/BiquadCascade.hpp"
+#include "DSP/CascadeDesign.hpp"
+
+namespace audio
+{
+    namespace effects
+    {
+
+        /**
+         * Multiband splitter with an effect chain per band
+         *
+         * N - 1 Linkwitz-Riley crossover points split the signal into N
+         * bands (2 to max_bands). The split is a tree: each point takes the
+         * lowpass of what is left as the next band and passes the highpass
+         * on. A band that leaves the tree early then runs through the
+         * Linkwitz-Riley allpass of every higher crossover point, so all
+         * bands carry the same phase shift and their sum is flat (an
+         * allpass of the input) when the chains are left empty. For LR2 /
+         * LR6 the highpass side is polarity-inverted so bands add in phase.
+         *
+         * After the split, each band's compensation filter and effect chain
+         * run in turn, then the bands are summed back into the buffer. For
+         * heavy offline work such as mastering renders, pass a pool you own
+         * and the bands run as parallel jobs on it instead. Inside another
+         * pool job (e.g. a band of an outer crossover) they run inline.
+         */
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
+        class Crossover : public AudioEffect<SampleType>
+        {
+        public:
+            /// Most bands a crossover can split into
+            static constexpr size_t max_bands = 6;
+
+            /**
+             * @param frequencies Ascending crossover points, 1 to max_bands - 1
+             * @param order Linkwitz-Riley order (even; 4 = 24 dB/octave)
+             * @param pool Optional pool for parallel bands (must outlive the crossover)
+             */
+            Crossover(double sample_rate, std::vector<double> frequencies, int order = 4,
+                      ThreadPool *pool = nullptr)
+                : sample_rate_(sample_rate), order_(order), frequencies_(std::move(frequencies)), pool_(pool)
+            {
+                if (frequencies_.empty() || frequencies_.size() >= max_bands)
+                {
+                    throw std::invalid_argument("Crossover needs 1 to " + std::to_string(max_bands - 1) + " crossover frequencies");
+                }
+
+                bands_.resize(frequencies_.size() + 1);
+                splits_.resize(frequencies_.size());
+                design();
+            }
+
+            /**
+             * Move one crossover point (filter history is kept)
+             * Points must stay in ascending order.
+             */
+            void set_frequency(size_t index, double freq)
+            {
+                const double previous = frequencies_.at(index);
+                frequencies_[index] = freq;
+                try
+                {
+                    design();
+                }
+                catch (...)
+                {
+                    frequencies_[index] = previous;
+                    design();
+                    throw;
+                }
+            }
+
+            size_t num_bands() const { return bands_.size(); }
+            int order() const { return order_; }
+            const std::vector<double> &frequencies() const { return frequencies_; }
+
+            /**
+             * Append an effect to a band's chain
+             * @return The effect, for later parameter changes
+             */
+            AudioEffect<SampleType> &add_effect(size_t band, std::unique_ptr<AudioEffect<SampleType>> effect)
+            {
+                if (!effect)
+                {
+                    throw std::invalid_argument("Band effect must not be null");
+                }
+                auto &chain = bands_.at(band).effects;
+                chain.push_back(std::move(effect));
+                return *chain.back();
+            }
+
+            template <typename Effect, typename... Args>
+            Effect &emplace_effect(size_t band, Args &&...args)
+            {
+                auto effect = std::make_unique<Effect>(std::forward<Args>(args)...);
+                Effect &ref = *effect;
+                add_effect(band, std::move(effect));
+                return ref;
+            }
+
+            void clear_effects(size_t band)
+            {
+                bands_.at(band).effects.clear();
+            }
+
+            size_t num_effects(size_t band) const { return bands_.at(band).effects.size(); }
+
+            /// A band's signal from the last process() call, after its effects
+            const AudioBuffer<SampleType> &band_output(size_t band) const { return bands_.at(band).buffer; }
+
+            void process(AudioBuffer<SampleType> &buffer) override
+            {
+                if (!this->is_enabled())
+                {
+                    return;
+                }
+
+                const size_t frames = buffer.num_samples();
+                const size_t num_channels = buffer.num_channels();
+                if (frames == 0 || num_channels == 0)
+                {
+                    return;
+                }
+
+                dsp::ScopedNoDenormals no_denormals;
+                for (auto &band : bands_)
+                {
+                    if (band.buffer.num_samples() != frames || band.buffer.num_channels() != num_channels)
+                    {
+                        band.buffer.resize(frames, num_channels);
+                    }
+                }
+
+                // Split: bands_[k] gets what is left before point k, the rest moves on through its highpass
+                const size_t total = buffer.total_samples();
+                std::copy(buffer.data(), buffer.data() + total, bands_.back().buffer.data());
+                for (size_t k = 0; k < splits_.size(); ++k)
+                {
+                    std::copy(bands_.back().buffer.data(), bands_.back().buffer.data() + total, bands_[k].buffer.data());
+                    splits_[k].process_buffer(bands_.back().buffer.data(), frames, num_channels);
+                }
+
+                if (pool_ != nullptr)
+                {
+                    pool_->parallel_for(bands_.size(), [&](size_t k)
+                    {
+                        process_band(bands_[k], frames, num_channels);
+                    });
+                }
+                else
+                {
+                    for (auto &band : bands_)
+                    {
+                        process_band(band, frames, num_channels);
+                    }
+                }
+
+                std::copy(bands_[0].buffer.data(), bands_[0].buffer.data() + total, buffer.data());
+                for (size_t k = 1; k < bands_.size(); ++k)
+                {
+                    buffer.mix(bands_[k].buffer);
+                }
+            }
+
+            void reset() override
+            {
+                for (auto &split : splits_)
+                {
+                    split.reset();
+                }
+                for (auto &band : bands_)
+                {
+                    band.filter.reset();
+                    for (auto &effect : band.effects)
+                    {
+                        effect->reset();
+                    }
+                }
+            }
+
+            const char *name() const override { return "Crossover"; }
+
+        private:
+            struct Band
+            {
+                dsp::BiquadCascade<SampleType, Policy> filter; // Lowpass at its upper point + allpasses above
+                std::vector<std::unique_ptr<AudioEffect<SampleType>>> effects;
+                AudioBuffer<SampleType> buffer;
+            };
+
+            // Lowpass + allpass compensation, then the band's chain
+            static void process_band(Band &band, size_t frames, size_t num_channels)
+            {
+                dsp::ScopedNoDenormals no_denormals; // Per job: pool threads have their own FP mode
+                band.filter.process_buffer(band.buffer.data(), frames, num_channels);
+                for (auto &effect : band.effects)
+                {
+                    if (effect->is_enabled())
+                    {
+                        effect->process(band.buffer);
+                    }
+                }
+            }
+
+            // (Re)design every filter; keeps state when section counts match
+            void design()
+            {
+                for (size_t k = 0; k < frequencies_.size(); ++k)
+                {
+                    if (frequencies_[k] <= 0.0 || frequencies_[k] >= sample_rate_ / 2.0 ||
+                        (k > 0 && frequencies_[k] <= frequencies_[k - 1]))
+                    {
+                        throw std::invalid_argument("Crossover frequencies must be ascending and below Nyquist");
+                    }
+                }
+
+                // Odd LR halves (LR2, LR6) sum in phase only with the highpass inverted
+                const bool invert_highpass = (order_ / 2) % 2 == 1;
+
+                for (size_t k = 0; k < splits_.size(); ++k)
+                {
+                    auto highpass = dsp::CascadeDesign::linkwitz_riley_highpass(sample_rate_, frequencies_[k], order_);
+                    if (invert_highpass)
+                    {
+                        highpass.front().b0 = -highpass.front().b0;
+                        highpass.front().b1 = -highpass.front().b1;
+                        highpass.front().b2 = -highpass.front().b2;
+                    }
+                    assign(splits_[k], highpass);
+                }
+
+                for (size_t k = 0; k < bands_.size(); ++k)
+                {
+                    std::vector<dsp::BiquadCoefficients> sections;
+                    if (k < frequencies_.size())
+                    {
+                        sections = dsp::CascadeDesign::linkwitz_riley_lowpass(sample_rate_, frequencies_[k], order_);
+                    }
+                    for (size_t j = k + 1; j < frequencies_.size(); ++j)
+                    {
+                        const auto allpass = dsp::CascadeDesign::linkwitz_riley_allpass(sample_rate_, frequencies_[j], order_);
+                        sections.insert(sections.end(), allpass.begin(), allpass.end());
+                    }
+                    assign(bands_[k].filter, sections);
+                }
+            }
+
+            static void assign(dsp::BiquadCascade<SampleType, Policy> &cascade, const std::vector<dsp::BiquadCoefficients> &sections)
+            {
+                if (cascade.num_sections() != sections.size())
+                {
+                    cascade = dsp::BiquadCascade<SampleType, Policy>(sections);
+                    return;
+                }
+                for (size_t i = 0; i < sections.size(); ++i)
+                {
+                    cascade.set_section(i, sections[i]);
+                }
+            }
+
+            double sample_rate_;
+            int order_;
+            std::vector<double> frequencies_;
+            ThreadPool *pool_; // Optional, caller-owned
+
+            std::vector<dsp::BiquadCascade<SampleType, Policy>> splits_; // Highpass per crossover point
+            std::vector<Band> bands_;
+        };
+
+    } // namespace effects
+} // namespace audio
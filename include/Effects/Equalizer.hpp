@@ -2,6 +2,10 @@
 
 #include "Effects/AudioEffect.hpp"
 #include "Effects/FilterEffects.hpp"
+#include "DSP/BiquadCascade.hpp"
+#include "DSP/CoefficientCache.hpp"
+#include "DSP/FrequencyResponse.hpp"
+#include "DSP/LinearPhaseBuilder.hpp"
 
 namespace audio
 {
@@ -25,8 +29,30 @@ namespace audio
         /**
          * Multi-band parametric equalizer
          * Professional-grade EQ with multiple bands
+         * All bands run as one fused biquad cascade (one pass over the buffer)
+         *
+         * set_linear_phase() switches to a linear-phase mode: the combined
+         * magnitude of the bands is sampled on a dense grid and turned into
+         * one symmetric FIR (frequency sampling, Kaiser window) applied by
+         * FIRFilter's partitioned FFT convolution, so the cost no longer
+         * depends on the band count. Every frequency is delayed by
+         * latency() samples. The window smooths the band magnitude over
+         * about linear_phase_resolution() Hz, so bands narrower than that
+         * (low bands with the default length) come out shallower than in
+         * the cascade; raise the tap count to resolve them.
+         * frequency_response() reports the kernel actually designed. Band edits redesign and prime the kernel on
+         * ThreadPool::shared() (see LinearPhaseBuilder); the audio thread
+         * swaps it in when ready and crossfades from the old kernel over up
+         * to crossfade_frames.
+         * Call prepare() with the channel count before streaming so the
+         * audio thread never allocates.
+         *
+         * Like the other effects, an Equalizer is not synchronised: band
+         * edits, set_linear_phase(), prepare() and process() must not run
+         * concurrently (call them from one thread, or hand edits to the
+         * audio thread). Only the kernel design runs elsewhere.
          */
-        template <typename SampleType>
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
         class Equalizer : public AudioEffect<SampleType>
         {
         public:
@@ -39,9 +65,11 @@ namespace audio
              */
             size_t add_band(double frequency, double gain_db, double bandwidth = 1.0)
             {
+                auto coeffs = dsp::CoefficientCache::shared().get(
+                    {dsp::FilterType::PeakingEQ, sample_rate_, frequency, bandwidth, gain_db});
                 bands_.emplace_back(frequency, gain_db, bandwidth);
-                filters_.push_back(std::make_unique<ParametricEQBand<SampleType>>(
-                    sample_rate_, frequency, gain_db, bandwidth));
+                cascade_.add_section(coeffs);
+                rebuild_kernel();
                 return bands_.size() - 1;
             }
 
@@ -53,7 +81,8 @@ namespace audio
                 if (index < bands_.size())
                 {
                     bands_.erase(bands_.begin() + index);
-                    filters_.erase(filters_.begin() + index);
+                    cascade_.remove_section(index);
+                    rebuild_kernel();
                 }
             }
 
@@ -65,7 +94,7 @@ namespace audio
                 if (index < bands_.size())
                 {
                     bands_[index].frequency = freq;
-                    filters_[index]->set_frequency(freq);
+                    update_band(index);
                 }
             }
 
@@ -74,7 +103,7 @@ namespace audio
                 if (index < bands_.size())
                 {
                     bands_[index].gain_db = gain_db;
-                    filters_[index]->set_gain(gain_db);
+                    update_band(index);
                 }
             }
 
@@ -83,7 +112,7 @@ namespace audio
                 if (index < bands_.size())
                 {
                     bands_[index].bandwidth = bandwidth;
-                    filters_[index]->set_bandwidth(bandwidth);
+                    update_band(index);
                 }
             }
 
@@ -92,29 +121,96 @@ namespace audio
                 if (index < bands_.size())
                 {
                     bands_[index].enabled = enabled;
+                    cascade_.set_section_enabled(index, enabled);
+                    rebuild_kernel();
                 }
             }
 
+            /**
+             * Switch between the minimum-phase cascade and the linear-phase FIR
+             * Enabling designs the first kernel before returning; call it
+             * while the EQ is not processing.
+             * @param num_taps Kernel length (odd); longer resolves narrower low bands
+             */
+            void set_linear_phase(bool enabled, size_t num_taps = default_linear_phase_taps)
+            {
+                if (num_taps % 2 == 0)
+                {
+                    throw std::invalid_argument("Linear-phase EQ length must be odd");
+                }
+
+                linear_phase_ = enabled;
+                linear_phase_taps_ = num_taps;
+                fir_.reset();
+                builder_->cancel();
+                if (enabled)
+                {
+                    prepare(num_channels_);
+                    rebuild_kernel();
+                    wait_for_kernel();
+                }
+            }
+
+            /**
+             * Size the linear-phase buffers for a channel count
+             * process() does this itself when the count changes, allocating
+             * on the audio thread; call it up front to avoid that.
+             */
+            void prepare(size_t num_channels)
+            {
+                if (num_channels == 0)
+                {
+                    throw std::invalid_argument("Channel count must be positive");
+                }
+
+                const bool changed = num_channels != num_channels_;
+                num_channels_ = num_channels;
+                history_.assign((linear_phase_taps_ - 1) * num_channels, SampleType(0));
+                prime_.resize(history_.size());
+                fade_.resize(crossfade_frames * num_channels);
+                reset_at_ = frames_seen_;
+                if (changed)
+                {
+                    rebuild_kernel(); // Kernels are prepared for a channel count
+                }
+            }
+
+            bool is_linear_phase() const { return linear_phase_; }
+
+            /// Delay in samples added by the current mode
+            size_t latency() const { return linear_phase_ ? (linear_phase_taps_ - 1) / 2 : 0; }
+
+            /**
+             * Block until the latest band change has been designed
+             * The next process() call uses it; for offline rendering.
+             */
+            void wait_for_kernel()
+            {
+                builder_->wait(history_, frames_seen_);
+            }
+
             /**
              * Process audio through all enabled bands
              */
             void process(AudioBuffer<SampleType> &buffer) override
             {
-                for (size_t i = 0; i < filters_.size(); ++i)
+                if (!linear_phase_)
                 {
-                    if (bands_[i].enabled)
-                    {
-                        filters_[i]->process(buffer);
-                    }
+                    cascade_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+                    return;
                 }
+                process_linear_phase(buffer);
             }
 
             void reset() override
             {
-                for (auto &filter : filters_)
+                cascade_.reset();
+                if (fir_)
                 {
-                    filter->reset();
+                    fir_->reset();
                 }
+                std::fill(history_.begin(), history_.end(), SampleType(0));
+                reset_at_ = frames_seen_; // Kernels primed before this point start over
             }
 
             /**
@@ -123,13 +219,50 @@ namespace audio
             size_t num_bands() const { return bands_.size(); }
             const EQBand &get_band(size_t index) const { return bands_.at(index); }
 
+            /**
+             * Combined response of the enabled bands
+             * For per-frame redraws pass a grid built once for this sample rate.
+             * In linear-phase mode the magnitude is that of the most recently
+             * designed kernel (interpolated from an FFT of its taps; call
+             * wait_for_kernel() after an edit to see it), and the phase is
+             * the pure delay of latency() samples.
+             */
+            dsp::FrequencyResponse frequency_response(std::span<const double> frequencies) const
+            {
+                auto out = dsp::frequency_response(cascade_, sample_rate_, frequencies);
+                apply_kernel_response(frequencies, out);
+                return out;
+            }
+
+            void frequency_response(const dsp::FrequencyGrid &grid, dsp::FrequencyResponse &out) const
+            {
+                if (grid.sample_rate() != sample_rate_)
+                {
+                    throw std::invalid_argument("Frequency grid sample rate does not match the EQ");
+                }
+                dsp::frequency_response(cascade_, grid, out);
+                apply_kernel_response(grid.frequencies(), out);
+            }
+
+            /**
+             * Width in Hz over which the linear-phase kernel smooths the band
+             * magnitude (main lobe of its Kaiser window, beta 6)
+             * Band features narrower than this cannot be reproduced.
+             */
+            double linear_phase_resolution() const
+            {
+                const double beta_over_pi = 6.0 / dsp::PI;
+                return 2.0 * sample_rate_ / static_cast<double>(linear_phase_taps_) * std::sqrt(1.0 + beta_over_pi * beta_over_pi);
+            }
+
             /**
              * Clear all bands
              */
             void clear()
             {
                 bands_.clear();
-                filters_.clear();
+                cascade_.clear();
+                rebuild_kernel();
             }
 
             /**
@@ -165,23 +298,226 @@ namespace audio
                 add_band(16000.0, 0.0, 1.0);
             }
 
+            /// Default linear-phase kernel length (~93 ms at 44.1 kHz)
+            static constexpr size_t default_linear_phase_taps = 4095;
+
+            /// Longest crossfade between an old and a new linear-phase kernel
+            static constexpr size_t crossfade_frames = 256;
+
         private:
+            using Builder = dsp::LinearPhaseBuilder<SampleType>;
+            using Kernel = typename Builder::Filter;
+
+            /**
+             * Linear-phase mode: magnitude of the designed kernel, linearly
+             * interpolated between its FFT bins, and phase -2 pi f / fs *
+             * latency wrapped to (-pi, pi]
+             */
+            void apply_kernel_response(std::span<const double> frequencies, dsp::FrequencyResponse &out) const
+            {
+                if (!linear_phase_)
+                {
+                    return;
+                }
+
+                if (const auto response = builder_->response())
+                {
+                    const auto &bins = *response;
+                    const double bins_per_hz = static_cast<double>(2 * (bins.size() - 1)) / sample_rate_;
+                    for (size_t i = 0; i < out.magnitude.size(); ++i)
+                    {
+                        const double position = std::clamp(frequencies[i] * bins_per_hz, 0.0, static_cast<double>(bins.size() - 1));
+                        const size_t k = std::min(static_cast<size_t>(position), bins.size() - 2);
+                        const double t = position - static_cast<double>(k);
+                        out.magnitude[i] = bins[k] + t * (bins[k + 1] - bins[k]);
+                    }
+                }
+
+                const double delay = static_cast<double>(latency());
+                for (size_t i = 0; i < out.phase.size(); ++i)
+                {
+                    const double phase = -dsp::TWO_PI * frequencies[i] / sample_rate_ * delay;
+                    out.phase[i] = std::remainder(phase, dsp::TWO_PI);
+                    if (out.phase[i] <= -dsp::PI)
+                    {
+                        out.phase[i] += dsp::TWO_PI;
+                    }
+                }
+            }
+
+            void update_band(size_t index)
+            {
+                // Automation path: design directly, the shared cache is for add_band() / presets
+                const auto &band = bands_[index];
+                cascade_.set_section(index, dsp::design_filter(
+                                                {dsp::FilterType::PeakingEQ, sample_rate_, band.frequency, band.bandwidth, band.gain_db}));
+                rebuild_kernel();
+            }
+
+            // Queue a kernel for the enabled bands (linear-phase mode only)
+            void rebuild_kernel()
+            {
+                if (!linear_phase_)
+                {
+                    return;
+                }
+
+                typename Builder::Spec spec;
+                for (size_t i = 0; i < cascade_.num_sections(); ++i)
+                {
+                    if (cascade_.is_section_enabled(i))
+                    {
+                        spec.sections.push_back(cascade_.section(i));
+                    }
+                }
+                spec.sample_rate = sample_rate_;
+                spec.num_taps = linear_phase_taps_;
+                spec.num_channels = num_channels_;
+                builder_->request(std::move(spec));
+            }
+
+            void process_linear_phase(AudioBuffer<SampleType> &buffer)
+            {
+                const size_t frames = buffer.num_samples();
+                const size_t num_channels = buffer.num_channels();
+                if (frames == 0 || num_channels == 0)
+                {
+                    return;
+                }
+
+                if (num_channels != num_channels_ ||
+                    history_.size() != (linear_phase_taps_ - 1) * num_channels)
+                {
+                    prepare(num_channels);
+                }
+
+                // A replaced kernel goes to the worker first; swap only while the slot is free
+                if (retiring_)
+                {
+                    builder_->retire(retiring_);
+                }
+                std::unique_ptr<Kernel> next;
+                if (!retiring_)
+                {
+                    uint64_t primed = 0;
+                    next = builder_->exchange(primed);
+                    if (next)
+                    {
+                        catch_up(*next, primed, num_channels);
+                    }
+                }
+
+                // Remember the latest num_taps - 1 input frames
+                const size_t total = frames * num_channels;
+                const size_t history_size = history_.size();
+                if (total >= history_size)
+                {
+                    std::copy(buffer.data() + total - history_size, buffer.data() + total, history_.begin());
+                }
+                else
+                {
+                    std::copy(history_.begin() + total, history_.end(), history_.begin());
+                    std::copy(buffer.data(), buffer.data() + total, history_.end() - total);
+                }
+                frames_seen_ += frames;
+                builder_->offer_history(history_, frames_seen_);
+
+                if (next && fir_)
+                {
+                    // Old and new kernels share the same delay, so a linear fade is seamless
+                    const size_t fade = std::min(frames, crossfade_frames);
+                    std::copy(buffer.data(), buffer.data() + fade * num_channels, fade_.begin());
+                    fir_->process_buffer(fade_.data(), fade, num_channels);
+                    next->process_buffer(buffer.data(), frames, num_channels);
+
+                    using value_type = simd::compute_t<SampleType>;
+                    const value_type step = value_type(1) / static_cast<value_type>(fade);
+                    SampleType *out = buffer.data();
+                    for (size_t i = 0; i < fade; ++i)
+                    {
+                        const value_type t = static_cast<value_type>(i + 1) * step;
+                        for (size_t ch = 0; ch < num_channels; ++ch)
+                        {
+                            const auto from = static_cast<value_type>(fade_[i * num_channels + ch]);
+                            const auto to = static_cast<value_type>(out[i * num_channels + ch]);
+                            out[i * num_channels + ch] = simd::saturate_cast<SampleType>(from + t * (to - from));
+                        }
+                    }
+
+                    retiring_ = std::move(fir_);
+                    builder_->retire(retiring_);
+                    fir_ = std::move(next);
+                    return;
+                }
+
+                if (next)
+                {
+                    fir_ = std::move(next);
+                }
+                if (fir_)
+                {
+                    fir_->process_buffer(buffer.data(), frames, num_channels);
+                }
+            }
+
+            /**
+             * Feed a new kernel the input that arrived after its snapshot
+             * Usually a block or less; the full history only after a reset,
+             * a channel change, a stalled audio thread or for a kernel
+             * designed while processing was stopped (published unprimed).
+             */
+            void catch_up(Kernel &kernel, uint64_t primed, size_t num_channels)
+            {
+                if (primed < reset_at_)
+                {
+                    kernel.reset();
+                    primed = reset_at_;
+                }
+
+                const size_t history_frames = linear_phase_taps_ - 1;
+                const auto missed = static_cast<size_t>(std::min<uint64_t>(frames_seen_ - primed, history_frames));
+                if (missed == 0)
+                {
+                    return;
+                }
+                const size_t count = missed * num_channels;
+                std::copy(history_.end() - count, history_.end(), prime_.begin());
+                kernel.process_buffer(prime_.data(), missed, num_channels);
+            }
+
             double sample_rate_;
             std::vector<EQBand> bands_;
-            std::vector<std::unique_ptr<ParametricEQBand<SampleType>>> filters_;
+            dsp::BiquadCascade<SampleType, Policy> cascade_; // One section per band
+
+            // Linear-phase mode
+            bool linear_phase_ = false;
+            size_t linear_phase_taps_ = default_linear_phase_taps;
+            std::unique_ptr<Builder> builder_ = std::make_unique<Builder>(); // Waits for its design task on destruction
+            std::unique_ptr<Kernel> fir_;                                    // Owned by the audio thread
+            std::unique_ptr<Kernel> retiring_;                               // Replaced kernel waiting for the worker
+            size_t num_channels_ = 2;                                        // Channel count the buffers are sized for
+            std::vector<SampleType> history_;                                // Last num_taps - 1 input frames
+            std::vector<SampleType> prime_;                                  // Catch-up scratch, sized like history_
+            std::vector<SampleType> fade_;                                   // Old kernel's output during a swap
+            uint64_t frames_seen_ = 0;                                       // Input frames processed so far
+            uint64_t reset_at_ = 0;                                          // frames_seen_ at the last reset()
         };
 
         /**
          * Simple 3-band EQ (Bass, Mid, Treble)
          * Easy to use for quick tone shaping
+         * Low shelf, mid peak and high shelf share a single cascade pass
          */
-        template <typename SampleType>
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
         class ThreeBandEQ : public AudioEffect<SampleType>
         {
         public:
             explicit ThreeBandEQ(double sample_rate)
                 : sample_rate_(sample_rate), low_shelf_{200.0, 0.0}, mid_peak_{1000.0, 0.0, 1.0}, high_shelf_{5000.0, 0.0}
             {
+                cascade_.add_section({}); // LowShelf
+                cascade_.add_section({}); // MidPeak
+                cascade_.add_section({}); // HighShelf
                 update_low_shelf();
                 update_mid_peak();
                 update_high_shelf();
@@ -189,17 +525,13 @@ namespace audio
 
             void process(AudioBuffer<SampleType> &buffer) override
             {
-                // Process through shelving filters and mid peak
-                process_low_shelf(buffer);
-                process_mid_peak(buffer);
-                process_high_shelf(buffer);
+                // Shelving filters and mid peak in one pass
+                cascade_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
             }
 
             void reset() override
             {
-                low_shelf_filter_.reset();
-                mid_peak_filter_.reset();
-                high_shelf_filter_.reset();
+                cascade_.reset();
             }
 
             // Simple interface: set bass, mid, treble in dB
@@ -225,38 +557,46 @@ namespace audio
             double mid() const { return mid_gain_; }
             double treble() const { return treble_gain_; }
 
-        private:
-            void update_low_shelf()
+            // Combined response of the three sections
+            dsp::FrequencyResponse frequency_response(std::span<const double> frequencies) const
             {
-                auto coeffs = dsp::FilterDesign::low_shelf(sample_rate_, 200.0, bass_gain_);
-                low_shelf_filter_.set_coefficients(coeffs);
+                return dsp::frequency_response(cascade_, sample_rate_, frequencies);
             }
 
-            void update_mid_peak()
+            void frequency_response(const dsp::FrequencyGrid &grid, dsp::FrequencyResponse &out) const
             {
-                auto coeffs = dsp::FilterDesign::peaking_eq(sample_rate_, 1000.0, mid_gain_, 1.0);
-                mid_peak_filter_.set_coefficients(coeffs);
+                if (grid.sample_rate() != sample_rate_)
+                {
+                    throw std::invalid_argument("Frequency grid sample rate does not match the EQ");
+                }
+                dsp::frequency_response(cascade_, grid, out);
             }
 
-            void update_high_shelf()
+        private:
+            // Section indices in cascade_
+            enum Section : size_t
             {
-                auto coeffs = dsp::FilterDesign::high_shelf(sample_rate_, 5000.0, treble_gain_);
-                high_shelf_filter_.set_coefficients(coeffs);
-            }
+                LowShelf = 0,
+                MidPeak = 1,
+                HighShelf = 2
+            };
 
-            void process_low_shelf(AudioBuffer<SampleType> &buffer)
+            void update_low_shelf()
             {
-                low_shelf_filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+                auto coeffs = dsp::design_filter({dsp::FilterType::LowShelf, sample_rate_, 200.0, 1.0, bass_gain_});
+                cascade_.set_section(LowShelf, coeffs);
             }
 
-            void process_mid_peak(AudioBuffer<SampleType> &buffer)
+            void update_mid_peak()
             {
-                mid_peak_filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+                auto coeffs = dsp::design_filter({dsp::FilterType::PeakingEQ, sample_rate_, 1000.0, 1.0, mid_gain_});
+                cascade_.set_section(MidPeak, coeffs);
             }
 
-            void process_high_shelf(AudioBuffer<SampleType> &buffer)
+            void update_high_shelf()
             {
-                high_shelf_filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+                auto coeffs = dsp::design_filter({dsp::FilterType::HighShelf, sample_rate_, 5000.0, 1.0, treble_gain_});
+                cascade_.set_section(HighShelf, coeffs);
             }
 
             double sample_rate_;
@@ -264,9 +604,7 @@ namespace audio
             double mid_gain_ = 0.0;
             double treble_gain_ = 0.0;
 
-            dsp::BiquadFilter<SampleType> low_shelf_filter_;
-            dsp::BiquadFilter<SampleType> mid_peak_filter_;
-            dsp::BiquadFilter<SampleType> high_shelf_filter_;
+            dsp::BiquadCascade<SampleType, Policy> cascade_;
 
             // Store design parameters
             struct
@@ -2,37 +2,109 @@
 
 #include "Effects/AudioEffect.hpp"
 #include "DSP/BiQuadFilter.hpp"
-#include "DSP/FilterDesign.hpp"
+#include "DSP/BiquadCascade.hpp"
+#include "DSP/CascadeDesign.hpp"
+#include "DSP/FIRFilter.hpp"
+#include "DSP/CoefficientCache.hpp"
 
 namespace audio
 {
     namespace effects
     {
 
+        namespace detail
+        {
+            /**
+             * Single-biquad effect with optional parameter smoothing
+             * Holds the filter and the glide time; subclasses keep their own
+             * parameters and pass each new design to set_design().
+             *
+             * The first design (construction) comes from the shared
+             * CoefficientCache, so preset loads that build many identical
+             * effects share the trig. Setter changes are automation: they
+             * design directly without the cache's lock, skip repeats of the
+             * last spec, and use FastFilterDesign while gliding.
+             */
+            template <typename SampleType, typename Policy>
+            class SmoothedFilterEffect : public AudioEffect<SampleType>
+            {
+            public:
+                void process(AudioBuffer<SampleType> &buffer) override
+                {
+                    dsp::ScopedNoDenormals no_denormals;
+                    filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+                }
+
+                void reset() override
+                {
+                    filter_.reset();
+                }
+
+                /**
+                 * Glide to new parameter values over this time instead of jumping
+                 * Coefficients are designed once per setter call and interpolated
+                 * per sample while processing; 0 (default) switches instantly.
+                 */
+                void set_smoothing_time(double seconds)
+                {
+                    smoothing_samples_ = static_cast<size_t>(std::max(0.0, seconds) * sample_rate_);
+                }
+
+                bool is_smoothing() const { return filter_.is_ramping(); }
+
+            protected:
+                explicit SmoothedFilterEffect(double sample_rate)
+                    : sample_rate_(sample_rate) {}
+
+                // Switch (or glide) to the design described by spec
+                void set_design(const dsp::FilterSpec &spec)
+                {
+                    if (!designed_)
+                    {
+                        filter_.set_coefficients(dsp::CoefficientCache::shared().get(spec));
+                    }
+                    else if (spec == spec_)
+                    {
+                        return;
+                    }
+                    else if (smoothing_samples_ > 0)
+                    {
+                        filter_.set_coefficients(dsp::design_filter<dsp::FastFilterDesign>(spec), smoothing_samples_);
+                    }
+                    else
+                    {
+                        filter_.set_coefficients(dsp::design_filter<dsp::FilterDesign>(spec));
+                    }
+                    spec_ = spec;
+                    designed_ = true;
+                }
+
+                double sample_rate_;
+
+            private:
+                size_t smoothing_samples_ = 0;
+                dsp::BiquadFilter<SampleType, Policy> filter_;
+
+                dsp::FilterSpec spec_; // Last design, valid once designed_
+                bool designed_ = false;
+            };
+        } // namespace detail
+
         /**
          * Low-pass filter effect
          * Removes high frequencies (makes sound warmer/darker)
+         * Policy picks the biquad precision/topology (see dsp::BiquadTopology)
          */
-        template <typename SampleType>
-        class LowpassEffect : public AudioEffect<SampleType>
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
+        class LowpassEffect : public detail::SmoothedFilterEffect<SampleType, Policy>
         {
         public:
             LowpassEffect(double sample_rate, double cutoff_freq, double q_factor = 0.707)
-                : sample_rate_(sample_rate), cutoff_freq_(cutoff_freq), q_factor_(q_factor)
+                : detail::SmoothedFilterEffect<SampleType, Policy>(sample_rate), cutoff_freq_(cutoff_freq), q_factor_(q_factor)
             {
                 update_coefficients();
             }
 
-            void process(AudioBuffer<SampleType> &buffer) override
-            {
-                filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
-            }
-
-            void reset() override
-            {
-                filter_.reset();
-            }
-
             // Parameter setters
             void set_cutoff(double freq)
             {
@@ -53,40 +125,27 @@ namespace audio
         private:
             void update_coefficients()
             {
-                auto coeffs = dsp::FilterDesign::lowpass(sample_rate_, cutoff_freq_, q_factor_);
-                filter_.set_coefficients(coeffs);
+                this->set_design({dsp::FilterType::Lowpass, this->sample_rate_, cutoff_freq_, q_factor_});
             }
 
-            double sample_rate_;
             double cutoff_freq_;
             double q_factor_;
-            dsp::BiquadFilter<SampleType> filter_;
         };
 
         /**
          * High-pass filter effect
          * Removes low frequencies (removes rumble/bass)
          */
-        template <typename SampleType>
-        class HighpassEffect : public AudioEffect<SampleType>
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
+        class HighpassEffect : public detail::SmoothedFilterEffect<SampleType, Policy>
         {
         public:
             HighpassEffect(double sample_rate, double cutoff_freq, double q_factor = 0.707)
-                : sample_rate_(sample_rate), cutoff_freq_(cutoff_freq), q_factor_(q_factor)
+                : detail::SmoothedFilterEffect<SampleType, Policy>(sample_rate), cutoff_freq_(cutoff_freq), q_factor_(q_factor)
             {
                 update_coefficients();
             }
 
-            void process(AudioBuffer<SampleType> &buffer) override
-            {
-                filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
-            }
-
-            void reset() override
-            {
-                filter_.reset();
-            }
-
             void set_cutoff(double freq)
             {
                 cutoff_freq_ = freq;
@@ -105,40 +164,27 @@ namespace audio
         private:
             void update_coefficients()
             {
-                auto coeffs = dsp::FilterDesign::highpass(sample_rate_, cutoff_freq_, q_factor_);
-                filter_.set_coefficients(coeffs);
+                this->set_design({dsp::FilterType::Highpass, this->sample_rate_, cutoff_freq_, q_factor_});
             }
 
-            double sample_rate_;
             double cutoff_freq_;
             double q_factor_;
-            dsp::BiquadFilter<SampleType> filter_;
         };
 
         /**
          * Band-pass filter effect
          * Only allows a specific frequency range
          */
-        template <typename SampleType>
-        class BandpassEffect : public AudioEffect<SampleType>
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
+        class BandpassEffect : public detail::SmoothedFilterEffect<SampleType, Policy>
         {
         public:
             BandpassEffect(double sample_rate, double center_freq, double bandwidth)
-                : sample_rate_(sample_rate), center_freq_(center_freq), bandwidth_(bandwidth)
+                : detail::SmoothedFilterEffect<SampleType, Policy>(sample_rate), center_freq_(center_freq), bandwidth_(bandwidth)
             {
                 update_coefficients();
             }
 
-            void process(AudioBuffer<SampleType> &buffer) override
-            {
-                filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
-            }
-
-            void reset() override
-            {
-                filter_.reset();
-            }
-
             void set_center_frequency(double freq)
             {
                 center_freq_ = freq;
@@ -157,41 +203,28 @@ namespace audio
         private:
             void update_coefficients()
             {
-                auto coeffs = dsp::FilterDesign::bandpass(sample_rate_, center_freq_, bandwidth_);
-                filter_.set_coefficients(coeffs);
+                this->set_design({dsp::FilterType::Bandpass, this->sample_rate_, center_freq_, bandwidth_});
             }
 
-            double sample_rate_;
             double center_freq_;
             double bandwidth_;
-            dsp::BiquadFilter<SampleType> filter_;
         };
 
         /**
          * Parametric EQ band
          * Boost or cut a specific frequency range
          */
-        template <typename SampleType>
-        class ParametricEQBand : public AudioEffect<SampleType>
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
+        class ParametricEQBand : public detail::SmoothedFilterEffect<SampleType, Policy>
         {
         public:
             ParametricEQBand(double sample_rate, double center_freq,
                              double gain_db, double bandwidth)
-                : sample_rate_(sample_rate), center_freq_(center_freq), gain_db_(gain_db), bandwidth_(bandwidth)
+                : detail::SmoothedFilterEffect<SampleType, Policy>(sample_rate), center_freq_(center_freq), gain_db_(gain_db), bandwidth_(bandwidth)
             {
                 update_coefficients();
             }
 
-            void process(AudioBuffer<SampleType> &buffer) override
-            {
-                filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
-            }
-
-            void reset() override
-            {
-                filter_.reset();
-            }
-
             void set_frequency(double freq)
             {
                 center_freq_ = freq;
@@ -217,16 +250,90 @@ namespace audio
         private:
             void update_coefficients()
             {
-                auto coeffs = dsp::FilterDesign::peaking_eq(
-                    sample_rate_, center_freq_, gain_db_, bandwidth_);
-                filter_.set_coefficients(coeffs);
+                this->set_design({dsp::FilterType::PeakingEQ, this->sample_rate_, center_freq_, bandwidth_, gain_db_});
             }
 
-            double sample_rate_;
             double center_freq_;
             double gain_db_;
             double bandwidth_;
-            dsp::BiquadFilter<SampleType> filter_;
+        };
+
+        /**
+         * Higher-order filter effect
+         * Runs a set of second-order sections (e.g. from dsp::CascadeDesign)
+         * as one fused cascade pass
+         */
+        template <typename SampleType, typename Policy = dsp::DoubleDF1>
+        class CascadeFilterEffect : public AudioEffect<SampleType>
+        {
+        public:
+            explicit CascadeFilterEffect(const std::vector<dsp::BiquadCoefficients> &sections)
+                : cascade_(sections) {}
+
+            void process(AudioBuffer<SampleType> &buffer) override
+            {
+                cascade_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+            }
+
+            void reset() override
+            {
+                cascade_.reset();
+            }
+
+            /**
+             * Replace the design
+             * Keeps the filter state when the section count is unchanged.
+             */
+            void set_sections(const std::vector<dsp::BiquadCoefficients> &sections)
+            {
+                if (sections.size() != cascade_.num_sections())
+                {
+                    cascade_ = dsp::BiquadCascade<SampleType, Policy>(sections);
+                    return;
+                }
+                for (size_t i = 0; i < sections.size(); ++i)
+                {
+                    cascade_.set_section(i, sections[i]);
+                }
+            }
+
+            size_t num_sections() const { return cascade_.num_sections(); }
+
+        private:
+            dsp::BiquadCascade<SampleType, Policy> cascade_;
+        };
+
+        /**
+         * FIR filter / convolution effect
+         * Linear-phase filters, room correction and other long impulse
+         * responses; long responses use partitioned FFT convolution
+         */
+        template <typename SampleType>
+        class FIRFilterEffect : public AudioEffect<SampleType>
+        {
+        public:
+            explicit FIRFilterEffect(std::span<const double> taps)
+                : filter_(taps) {}
+
+            void process(AudioBuffer<SampleType> &buffer) override
+            {
+                filter_.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+            }
+
+            void reset() override
+            {
+                filter_.reset();
+            }
+
+            void set_taps(std::span<const double> taps)
+            {
+                filter_.set_taps(taps);
+            }
+
+            size_t num_taps() const { return filter_.num_taps(); }
+
+        private:
+            dsp::FIRFilter<SampleType> filter_;
         };
 
     } // namespace effects
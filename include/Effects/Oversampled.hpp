@@ -0,0 +1,227 @@
+#pragma once
+
+#include "project.h"
+#include "AudioBuffer.hpp"
+#include "Effects/AudioEffect.hpp"
+#include "DSP/Denormals.hpp"
+#include "DSP/HalfBand.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace effects
+    {
+
+        namespace detail
+        {
+            template <typename SampleType>
+            SampleType effect_sample_type(const AudioEffect<SampleType> *);
+        }
+
+        /**
+         * Runs a nonlinear effect at 2x, 4x or 8x the sample rate
+         *
+         * Each octave of oversampling is a polyphase half-band FIR stage
+         * (linear phase, ~80 dB rejection). The first stage does the real
+         * anti-imaging/anti-aliasing work with a long filter; later stages
+         * only need to keep the already band-limited signal clean, so they
+         * use short ones. The inner effect sees factor() times as many
+         * frames per buffer; give it the raised sample rate if it has
+         * rate-dependent parameters.
+         *
+         * latency() reports the combined delay of the up and down stages.
+         */
+        template <typename Effect>
+        class Oversampled : public AudioEffect<decltype(detail::effect_sample_type(std::declval<Effect *>()))>
+        {
+        public:
+            using SampleType = decltype(detail::effect_sample_type(std::declval<Effect *>()));
+            using value_type = simd::compute_t<SampleType>;
+
+            /// Half-band lengths: first (widest-band) stage and the rest
+            static constexpr size_t first_stage_taps = 47;
+            static constexpr size_t later_stage_taps = 23;
+
+            /**
+             * @param factor Oversampling factor: 1, 2, 4 or 8
+             * @param args Constructor arguments for the inner effect
+             */
+            template <typename... Args>
+            explicit Oversampled(size_t factor, Args &&...args)
+                : effect_(std::forward<Args>(args)...)
+            {
+                if (factor != 1 && factor != 2 && factor != 4 && factor != 8)
+                {
+                    throw std::invalid_argument("Oversampling factor must be 1, 2, 4 or 8");
+                }
+
+                factor_ = factor;
+                num_stages_ = factor == 1 ? 0 : factor == 2 ? 1 : factor == 4 ? 2 : 3;
+            }
+
+            void process(AudioBuffer<SampleType> &buffer) override
+            {
+                if (!this->is_enabled())
+                {
+                    return;
+                }
+                if (num_stages_ == 0)
+                {
+                    effect_.process(buffer);
+                    return;
+                }
+
+                const size_t frames = buffer.num_samples();
+                const size_t num_channels = buffer.num_channels();
+                if (frames == 0 || num_channels == 0)
+                {
+                    return;
+                }
+
+                dsp::ScopedNoDenormals no_denormals;
+                prepare(num_channels);
+                if (upsampled_.num_samples() != frames * factor_ || upsampled_.num_channels() != num_channels)
+                {
+                    upsampled_.resize(frames * factor_, num_channels);
+                }
+
+                // Up: channel -> stages -> interleaved high-rate buffer
+                for (size_t ch = 0; ch < num_channels; ++ch)
+                {
+                    work_a_.resize(frames * factor_);
+                    work_b_.resize(frames * factor_);
+                    const SampleType *in = buffer.data() + ch;
+                    for (size_t i = 0; i < frames; ++i)
+                    {
+                        work_a_[i] = static_cast<value_type>(in[i * num_channels]);
+                    }
+
+                    size_t length = frames;
+                    for (size_t s = 0; s < num_stages_; ++s)
+                    {
+                        channels_[ch].up[s].process(work_a_.data(), length, work_b_.data());
+                        std::swap(work_a_, work_b_);
+                        length *= 2;
+                    }
+
+                    SampleType *out = upsampled_.data() + ch;
+                    for (size_t i = 0; i < length; ++i)
+                    {
+                        out[i * num_channels] = simd::saturate_cast<SampleType>(work_a_[i]);
+                    }
+                }
+
+                effect_.process(upsampled_);
+
+                // Down: stages in reverse, from the highest rate
+                for (size_t ch = 0; ch < num_channels; ++ch)
+                {
+                    size_t length = frames * factor_;
+                    const SampleType *in = upsampled_.data() + ch;
+                    for (size_t i = 0; i < length; ++i)
+                    {
+                        work_a_[i] = static_cast<value_type>(in[i * num_channels]);
+                    }
+
+                    for (size_t s = num_stages_; s-- > 0;)
+                    {
+                        length /= 2;
+                        channels_[ch].down[s].process(work_a_.data(), length, work_b_.data());
+                        std::swap(work_a_, work_b_);
+                    }
+
+                    SampleType *out = buffer.data() + ch;
+                    for (size_t i = 0; i < frames; ++i)
+                    {
+                        out[i * num_channels] = simd::saturate_cast<SampleType>(work_a_[i]);
+                    }
+                }
+            }
+
+            void reset() override
+            {
+                effect_.reset();
+                for (auto &channel : channels_)
+                {
+                    for (auto &stage : channel.up)
+                    {
+                        stage.reset();
+                    }
+                    for (auto &stage : channel.down)
+                    {
+                        stage.reset();
+                    }
+                }
+            }
+
+            const char *name() const override { return "Oversampled"; }
+
+            size_t factor() const { return factor_; }
+
+            /**
+             * Delay added by the resampling stages, in samples at the base rate
+             * Stage s (running at 2^s times the base rate) delays by
+             * num_taps - 1 samples at its rate, up and down together.
+             */
+            double latency() const
+            {
+                double samples = 0.0;
+                for (size_t s = 1; s <= num_stages_; ++s)
+                {
+                    const double taps = static_cast<double>(stage_taps(s - 1));
+                    samples += (taps - 1.0) / static_cast<double>(size_t(1) << s);
+                }
+                return samples;
+            }
+
+            Effect &effect() { return effect_; }
+            const Effect &effect() const { return effect_; }
+
+        private:
+            struct ChannelStages
+            {
+                std::vector<dsp::HalfBandInterpolator<value_type>> up;
+                std::vector<dsp::HalfBandDecimator<value_type>> down;
+            };
+
+            static size_t stage_taps(size_t stage)
+            {
+                return stage == 0 ? first_stage_taps : later_stage_taps;
+            }
+
+            void prepare(size_t num_channels)
+            {
+                if (designs_.empty())
+                {
+                    for (size_t s = 0; s < num_stages_; ++s)
+                    {
+                        designs_.push_back(dsp::HalfBandDesign::design(stage_taps(s)));
+                    }
+                }
+
+                while (channels_.size() < num_channels)
+                {
+                    ChannelStages stages;
+                    for (size_t s = 0; s < num_stages_; ++s)
+                    {
+                        stages.up.emplace_back(designs_[s]);
+                        stages.down.emplace_back(designs_[s]);
+                    }
+                    channels_.push_back(std::move(stages));
+                }
+            }
+
+            Effect effect_;
+            size_t factor_ = 1;
+            size_t num_stages_ = 0;
+
+            std::vector<std::vector<double>> designs_; // Half-band taps per stage
+            std::vector<ChannelStages> channels_;
+
+            AudioBuffer<SampleType> upsampled_;
+            std::vector<value_type> work_a_;
+            std::vector<value_type> work_b_;
+        };
+
+    } // namespace effects
+} // namespace audio
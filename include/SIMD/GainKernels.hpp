@@ -0,0 +1,131 @@
+#pragma once
+
+#include "project.h"
+#include "ChannelDispatch.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace simd
+    {
+        /**
+         * Multiply samples by a constant gain
+         * @param data Interleaved samples
+         * @param count Number of samples (frames * channels)
+         */
+        template <typename SampleType>
+        inline void apply_gain(SampleType *AUDIO_RESTRICT data, size_t count, float gain)
+        {
+            using C = compute_t<SampleType>;
+            const C g = static_cast<C>(gain);
+
+            AUDIO_SIMD_LOOP
+            for (size_t i = 0; i < count; ++i)
+            {
+                data[i] = saturate_cast<SampleType>(static_cast<C>(data[i]) * g);
+            }
+        }
+
+        /**
+         * Multiply frames by a gain ramping linearly from start_gain to end_gain
+         * Frame i gets start + (end - start) * i / num_frames, so consecutive
+         * blocks chained on end_gain are continuous.
+         */
+        template <typename SampleType>
+        inline void apply_gain_ramp(SampleType *AUDIO_RESTRICT data, size_t num_frames, size_t num_channels,
+                                    float start_gain, float end_gain)
+        {
+            if (num_frames == 0)
+                return;
+
+            using C = compute_t<SampleType>;
+            const C start = static_cast<C>(start_gain);
+            const C step = (static_cast<C>(end_gain) - start) / static_cast<C>(num_frames);
+
+            dispatch_channels(num_channels, [&](auto channels)
+            {
+                const size_t stride = resolve_channels<decltype(channels)::value>(num_channels);
+
+                AUDIO_SIMD_LOOP
+                for (size_t i = 0; i < num_frames; ++i)
+                {
+                    const C gain = start + step * static_cast<C>(i);
+                    for (size_t ch = 0; ch < stride; ++ch)
+                    {
+                        const size_t index = i * stride + ch;
+                        data[index] = saturate_cast<SampleType>(static_cast<C>(data[index]) * gain);
+                    }
+                }
+            });
+        }
+
+        /**
+         * dest += source * gain
+         */
+        template <typename SampleType>
+        inline void mix(SampleType *AUDIO_RESTRICT dest, const SampleType *AUDIO_RESTRICT source,
+                        size_t count, float gain = 1.0f)
+        {
+            using C = compute_t<SampleType>;
+            const C g = static_cast<C>(gain);
+
+            AUDIO_SIMD_LOOP
+            for (size_t i = 0; i < count; ++i)
+            {
+                dest[i] = saturate_cast<SampleType>(static_cast<C>(dest[i]) + static_cast<C>(source[i]) * g);
+            }
+        }
+
+        /**
+         * dest = (dest + source * source_gain) * output_gain
+         * One pass for weighted sums such as averaging two sources
+         */
+        template <typename SampleType>
+        inline void mix_scaled(SampleType *AUDIO_RESTRICT dest, const SampleType *AUDIO_RESTRICT source,
+                               size_t count, float source_gain, float output_gain)
+        {
+            using C = compute_t<SampleType>;
+            const C sg = static_cast<C>(source_gain);
+            const C og = static_cast<C>(output_gain);
+
+            AUDIO_SIMD_LOOP
+            for (size_t i = 0; i < count; ++i)
+            {
+                dest[i] = saturate_cast<SampleType>((static_cast<C>(dest[i]) + static_cast<C>(source[i]) * sg) * og);
+            }
+        }
+
+        /**
+         * dest += source * gain, with gain ramping linearly per frame
+         * (same ramp convention as apply_gain_ramp)
+         */
+        template <typename SampleType>
+        inline void mix_ramp(SampleType *AUDIO_RESTRICT dest, const SampleType *AUDIO_RESTRICT source,
+                             size_t num_frames, size_t num_channels, float start_gain, float end_gain)
+        {
+            if (num_frames == 0)
+                return;
+
+            using C = compute_t<SampleType>;
+            const C start = static_cast<C>(start_gain);
+            const C step = (static_cast<C>(end_gain) - start) / static_cast<C>(num_frames);
+
+            dispatch_channels(num_channels, [&](auto channels)
+            {
+                const size_t stride = resolve_channels<decltype(channels)::value>(num_channels);
+
+                AUDIO_SIMD_LOOP
+                for (size_t i = 0; i < num_frames; ++i)
+                {
+                    const C gain = start + step * static_cast<C>(i);
+                    for (size_t ch = 0; ch < stride; ++ch)
+                    {
+                        const size_t index = i * stride + ch;
+                        dest[index] = saturate_cast<SampleType>(
+                            static_cast<C>(dest[index]) + static_cast<C>(source[index]) * gain);
+                    }
+                }
+            });
+        }
+    } // namespace simd
+} // namespace audio
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "project.h"
+#include "ChannelDispatch.hpp"
+#include "SIMD/SimdConfig.hpp"
+
+namespace audio
+{
+    namespace simd
+    {
+        namespace detail
+        {
+            // Frames per tile for the generic N-channel path; keeps the
+            // interleaved source tile resident in L1 while each channel is copied
+            inline constexpr size_t interleave_tile_frames = 64;
+
+            /**
+             * Channel layouts with unrolled interleave kernels
+             * Adds 6 (5.1) to the common dispatch_channels set
+             */
+            template <typename Func>
+            decltype(auto) dispatch_layout(size_t num_channels, Func &&func)
+            {
+                switch (num_channels)
+                {
+                case 1:
+                    return func(std::integral_constant<size_t, 1>{});
+                case 2:
+                    return func(std::integral_constant<size_t, 2>{});
+                case 4:
+                    return func(std::integral_constant<size_t, 4>{});
+                case 6:
+                    return func(std::integral_constant<size_t, 6>{});
+                case 8:
+                    return func(std::integral_constant<size_t, 8>{});
+                default:
+                    return func(std::integral_constant<size_t, dynamic_channels>{});
+                }
+            }
+        } // namespace detail
+
+        /**
+         * Copy one channel out of an interleaved block
+         * @param out Destination for num_frames contiguous samples
+         */
+        template <typename SampleType>
+        inline void extract_channel(const SampleType *AUDIO_RESTRICT interleaved, size_t num_frames,
+                                    size_t num_channels, size_t channel, SampleType *AUDIO_RESTRICT out)
+        {
+            const SampleType *src = interleaved + channel;
+
+            AUDIO_SIMD_LOOP
+            for (size_t i = 0; i < num_frames; ++i)
+            {
+                out[i] = src[i * num_channels];
+            }
+        }
+
+        /**
+         * Copy contiguous samples into one channel of an interleaved block
+         */
+        template <typename SampleType>
+        inline void insert_channel(const SampleType *AUDIO_RESTRICT in, size_t num_frames,
+                                   size_t num_channels, size_t channel, SampleType *AUDIO_RESTRICT interleaved)
+        {
+            SampleType *dst = interleaved + channel;
+
+            AUDIO_SIMD_LOOP
+            for (size_t i = 0; i < num_frames; ++i)
+            {
+                dst[i * num_channels] = in[i];
+            }
+        }
+
+        /**
+         * Split an interleaved block into one contiguous array per channel
+         * Unrolled for 1, 2, 4, 6 and 8 channels, tiled for other counts
+         * @param planar num_channels destination pointers, num_frames samples each
+         */
+        template <typename SampleType>
+        inline void deinterleave(const SampleType *AUDIO_RESTRICT interleaved, size_t num_frames,
+                                 size_t num_channels, SampleType *const *planar)
+        {
+            detail::dispatch_layout(num_channels, [&](auto channels)
+            {
+                constexpr size_t Channels = decltype(channels)::value;
+
+                if constexpr (Channels == dynamic_channels)
+                {
+                    for (size_t start = 0; start < num_frames; start += detail::interleave_tile_frames)
+                    {
+                        const size_t count = std::min(detail::interleave_tile_frames, num_frames - start);
+                        for (size_t ch = 0; ch < num_channels; ++ch)
+                        {
+                            extract_channel(interleaved + start * num_channels, count, num_channels,
+                                            ch, planar[ch] + start);
+                        }
+                    }
+                }
+                else
+                {
+                    SampleType *out[Channels];
+                    for (size_t ch = 0; ch < Channels; ++ch)
+                    {
+                        out[ch] = planar[ch];
+                    }
+
+                    for (size_t i = 0; i < num_frames; ++i)
+                    {
+                        const SampleType *frame = interleaved + i * Channels;
+                        for (size_t ch = 0; ch < Channels; ++ch)
+                        {
+                            out[ch][i] = frame[ch];
+                        }
+                    }
+                }
+            });
+        }
+
+        /**
+         * Merge one contiguous array per channel into an interleaved block
+         * Inverse of deinterleave(), same specialisations
+         */
+        template <typename SampleType>
+        inline void interleave(const SampleType *const *planar, size_t num_frames,
+                               size_t num_channels, SampleType *AUDIO_RESTRICT interleaved)
+        {
+            detail::dispatch_layout(num_channels, [&](auto channels)
+            {
+                constexpr size_t Channels = decltype(channels)::value;
+
+                if constexpr (Channels == dynamic_channels)
+                {
+                    for (size_t start = 0; start < num_frames; start += detail::interleave_tile_frames)
+                    {
+                        const size_t count = std::min(detail::interleave_tile_frames, num_frames - start);
+                        for (size_t ch = 0; ch < num_channels; ++ch)
+                        {
+                            insert_channel(planar[ch] + start, count, num_channels,
+                                           ch, interleaved + start * num_channels);
+                        }
+                    }
+                }
+                else
+                {
+                    const SampleType *in[Channels];
+                    for (size_t ch = 0; ch < Channels; ++ch)
+                    {
+                        in[ch] = planar[ch];
+                    }
+
+                    for (size_t i = 0; i < num_frames; ++i)
+                    {
+                        SampleType *frame = interleaved + i * Channels;
+                        for (size_t ch = 0; ch < Channels; ++ch)
+                        {
+                            frame[ch] = in[ch][i];
+                        }
+                    }
+                }
+            });
+        }
+
+        /**
+         * Route channels between two interleaved blocks
+         * Output channel c of every frame is input channel channel_map[c], so
+         * the map can reorder, drop or duplicate channels (e.g. 7.1.4 layouts).
+         * @param in_channels Channel count of the input block
+         * @param channel_map One source index per output channel
+         */
+        template <typename SampleType>
+        inline void shuffle_channels(const SampleType *AUDIO_RESTRICT in, size_t num_frames, size_t in_channels,
+                                     std::span<const size_t> channel_map, SampleType *AUDIO_RESTRICT out)
+        {
+            const size_t out_channels = channel_map.size();
+            for (size_t map : channel_map)
+            {
+                if (map >= in_channels)
+                {
+                    throw std::out_of_range("Channel map index out of range");
+                }
+            }
+
+            // Tiled so each output channel is a strided copy over an L1-resident tile
+            for (size_t start = 0; start < num_frames; start += detail::interleave_tile_frames)
+            {
+                const size_t count = std::min(detail::interleave_tile_frames, num_frames - start);
+                const SampleType *src_tile = in + start * in_channels;
+                SampleType *dst_tile = out + start * out_channels;
+
+                for (size_t ch = 0; ch < out_channels; ++ch)
+                {
+                    const SampleType *src = src_tile + channel_map[ch];
+                    SampleType *dst = dst_tile + ch;
+
+                    AUDIO_SIMD_LOOP
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        dst[i * out_channels] = src[i * in_channels];
+                    }
+                }
+            }
+        }
+    } // namespace simd
+} // namespace audio
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "project.h"
+
+// ============================================================================
+// Portable hints for the auto-vectoriser
+//
+// Kernels are written as contiguous, branch-free loops over restrict-qualified
+// pointers; these macros tell the compiler the iterations are independent so
+// it emits packed SSE/AVX/NEON code for whatever target it was built for
+// (see ENABLE_NATIVE_ARCH in CMakeLists.txt).
+//
+// AUDIO_SIMD_LANES marks a short fixed-count loop over lanes (one lane per
+// independent stream) inside a recurrence. GCC would otherwise unroll it
+// completely and leave the lane state in scalar registers.
+// ============================================================================
+
+#if defined(__clang__)
+#define AUDIO_RESTRICT __restrict__
+#define AUDIO_SIMD_LOOP _Pragma("clang loop vectorize(enable) interleave(enable)")
+#define AUDIO_SIMD_LANES _Pragma("clang loop vectorize(enable)")
+#elif defined(__GNUC__)
+#define AUDIO_RESTRICT __restrict__
+#define AUDIO_SIMD_LOOP _Pragma("GCC ivdep")
+#define AUDIO_SIMD_LANES _Pragma("GCC ivdep") _Pragma("GCC unroll 1")
+#elif defined(_MSC_VER)
+#define AUDIO_RESTRICT __restrict
+#define AUDIO_SIMD_LOOP __pragma(loop(ivdep))
+#define AUDIO_SIMD_LANES __pragma(loop(ivdep))
+#else
+#define AUDIO_RESTRICT
+#define AUDIO_SIMD_LOOP
+#define AUDIO_SIMD_LANES
+#endif
+
+namespace audio
+{
+    namespace simd
+    {
+        /// Width in bytes of the widest vector register the target enables
+#if defined(__AVX512F__)
+        inline constexpr size_t vector_bytes = 64;
+#elif defined(__AVX__)
+        inline constexpr size_t vector_bytes = 32;
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__ARM_NEON)
+        inline constexpr size_t vector_bytes = 16;
+#else
+        inline constexpr size_t vector_bytes = sizeof(double);
+#endif
+
+        /// Number of T values that fit in one vector register
+        template <typename T>
+        inline constexpr size_t lanes = vector_bytes / sizeof(T) > 0 ? vector_bytes / sizeof(T) : 1;
+
+        /**
+         * Arithmetic type used by per-sample kernels
+         * float for float/int16, double for double/int32 (24-bit fits a double exactly)
+         */
+        template <typename SampleType>
+        using compute_t = std::conditional_t<(sizeof(SampleType) > 2 && !std::is_same_v<SampleType, float>), double, float>;
+
+        /**
+         * Store a computed value as SampleType
+         * Integer types saturate instead of wrapping
+         */
+        template <typename SampleType, typename T>
+        inline SampleType saturate_cast(T value)
+        {
+            if constexpr (std::is_integral_v<SampleType>)
+            {
+                constexpr T lo = static_cast<T>(std::numeric_limits<SampleType>::min());
+                constexpr T hi = static_cast<T>(std::numeric_limits<SampleType>::max());
+                return static_cast<SampleType>(std::min(hi, std::max(lo, value)));
+            }
+            else
+            {
+                return static_cast<SampleType>(value);
+            }
+        }
+    } // namespace simd
+} // namespace audio
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "project.h"
+#include "AudioBuffer.hpp"
+
+#include <atomic>
+
+namespace audio
+{
+    /**
+     * @brief Reference-counted, copy-on-write handle to an AudioBuffer
+     *
+     * Copying the handle shares the underlying samples. The first call to
+     * write() on a shared handle detaches it with a single deep copy, so
+     * branches of a processing graph that only read never duplicate data.
+     *
+     * Each handle object belongs to one thread at a time; distinct handles
+     * sharing the same storage may be read and written from different threads.
+     */
+    template <typename SampleType>
+    class SharedAudioBuffer
+    {
+    public:
+        /// Default constructor (empty handle)
+        SharedAudioBuffer() = default;
+
+        /// Take ownership of an existing buffer without copying it
+        explicit SharedAudioBuffer(AudioBuffer<SampleType> &&buffer)
+            : data_(std::make_shared<AudioBuffer<SampleType>>(std::move(buffer))) {}
+
+        /// Share a deep copy of an existing buffer
+        explicit SharedAudioBuffer(const AudioBuffer<SampleType> &buffer)
+            : data_(std::make_shared<AudioBuffer<SampleType>>(buffer)) {}
+
+        /// Allocate a new silent buffer
+        SharedAudioBuffer(size_t num_samples, size_t num_channels)
+            : data_(std::make_shared<AudioBuffer<SampleType>>(num_samples, num_channels)) {}
+
+        /**
+         * @brief Read-only access, never copies
+         */
+        const AudioBuffer<SampleType> &read() const
+        {
+            if (!data_)
+            {
+                return empty_buffer();
+            }
+            return *data_;
+        }
+
+        /**
+         * @brief Mutable access, detaches from other handles first
+         */
+        AudioBuffer<SampleType> &write()
+        {
+            if (!data_)
+            {
+                data_ = std::make_shared<AudioBuffer<SampleType>>();
+            }
+            else if (data_.use_count() > 1)
+            {
+                data_ = std::make_shared<AudioBuffer<SampleType>>(*data_);
+            }
+            else
+            {
+                // Pairs with the release in the last other owner's destructor,
+                // so its reads happen-before our writes
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return *data_;
+        }
+
+        /**
+         * @brief Move the buffer out, copying only if still shared
+         */
+        AudioBuffer<SampleType> release()
+        {
+            if (!data_)
+            {
+                return {};
+            }
+
+            AudioBuffer<SampleType> result = data_.use_count() > 1
+                                                 ? AudioBuffer<SampleType>(*data_)
+                                                 : std::move(*data_);
+            data_.reset();
+            return result;
+        }
+
+        /// True if another handle currently shares the same storage
+        bool is_shared() const { return data_.use_count() > 1; }
+
+        /// Number of handles sharing the storage (0 for an empty handle)
+        long use_count() const { return data_.use_count(); }
+
+        bool empty() const { return !data_ || data_->empty(); }
+
+        /// True if both handles point at the same storage
+        bool shares_with(const SharedAudioBuffer &other) const
+        {
+            return data_ && data_ == other.data_;
+        }
+
+        size_t num_samples() const { return read().num_samples(); }
+        size_t num_channels() const { return read().num_channels(); }
+
+    private:
+        static const AudioBuffer<SampleType> &empty_buffer()
+        {
+            static const AudioBuffer<SampleType> empty;
+            return empty;
+        }
+
+        std::shared_ptr<AudioBuffer<SampleType>> data_;
+    };
+} // namespace audio
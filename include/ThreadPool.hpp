@@ -0,0 +1,255 @@
+#pragma once
+
+#include "project.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace audio
+{
+    /**
+     * @brief Fixed set of worker threads for data-parallel offline jobs
+     *
+     * parallel_for() hands out indices to the workers and the calling thread
+     * and returns when every index has run. Jobs from different callers are
+     * serialised. A parallel_for() issued from inside a job (of any pool)
+     * runs inline on that thread, so nested users cannot deadlock.
+     * post() queues a single background task (long control-side work such
+     * as filter design) for the next free worker.
+     * Not intended for the real-time audio thread.
+     */
+    class ThreadPool
+    {
+    public:
+        /// @param num_threads Total threads including the caller (>= 1)
+        explicit ThreadPool(size_t num_threads = default_threads())
+        {
+            if (num_threads == 0)
+            {
+                throw std::invalid_argument("Thread pool needs at least one thread");
+            }
+
+            workers_.reserve(num_threads - 1);
+            for (size_t i = 1; i < num_threads; ++i)
+            {
+                workers_.emplace_back([this]
+                                      { worker_loop(); });
+            }
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto &worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /// Threads that run a job, including the caller
+        size_t num_threads() const { return workers_.size() + 1; }
+
+        /**
+         * @brief Run func(i) for every i in [0, count), in parallel
+         * The first exception thrown by a job is rethrown here once all
+         * indices have finished.
+         */
+        template <typename Func>
+        void parallel_for(size_t count, Func &&func)
+        {
+            if (count == 0)
+                return;
+
+            if (workers_.empty() || count == 1 || in_job())
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    func(i);
+                }
+                return;
+            }
+
+            std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+            std::function<void(size_t)> job(std::ref(func));
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                job_ = &job;
+                job_count_ = count;
+                next_.store(0, std::memory_order_relaxed);
+                completed_ = 0;
+                error_ = nullptr;
+                ++generation_;
+            }
+            wake_.notify_all();
+
+            run_indices(job, count);
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [&]
+                       { return completed_ == count && active_ == 0; });
+            job_ = nullptr;
+
+            if (error_)
+            {
+                std::rethrow_exception(std::exchange(error_, nullptr));
+            }
+        }
+
+        /**
+         * @brief Run task() on a worker without waiting for it
+         * A pool without workers runs it inline. The task must not throw.
+         * Tasks still queued when the pool is destroyed run before it returns.
+         */
+        void post(std::function<void()> task)
+        {
+            if (workers_.empty())
+            {
+                task();
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                tasks_.push_back(std::move(task));
+            }
+            wake_.notify_one();
+        }
+
+        /// Process-wide pool sized to the hardware
+        static ThreadPool &shared()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        static size_t default_threads()
+        {
+            return std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        /// True while the current thread is running a parallel_for() job
+        static bool in_job() noexcept
+        {
+            return job_flag();
+        }
+
+    private:
+        static bool &job_flag() noexcept
+        {
+            thread_local bool flag = false;
+            return flag;
+        }
+
+        void worker_loop()
+        {
+            uint64_t seen = 0;
+            while (true)
+            {
+                std::function<void(size_t)> *job = nullptr;
+                std::function<void()> task;
+                size_t count = 0;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    wake_.wait(lock, [&]
+                               { return stop_ || generation_ != seen || !tasks_.empty(); });
+
+                    if (generation_ != seen)
+                    {
+                        seen = generation_;
+                        if (!job_)
+                            continue; // Woke after the job already finished
+                        job = job_;
+                        count = job_count_;
+                        ++active_;
+                    }
+                    else if (!tasks_.empty())
+                    {
+                        task = std::move(tasks_.front());
+                        tasks_.pop_front();
+                    }
+                    else
+                    {
+                        return; // Stopped with nothing queued
+                    }
+                }
+
+                if (task)
+                {
+                    task();
+                    continue;
+                }
+
+                run_indices(*job, count);
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    --active_;
+                }
+                done_.notify_all();
+            }
+        }
+
+        void run_indices(std::function<void(size_t)> &job, size_t count)
+        {
+            bool &flag = job_flag();
+            const bool outer = flag;
+            flag = true;
+
+            size_t finished = 0;
+            for (size_t i = next_.fetch_add(1, std::memory_order_relaxed); i < count;
+                 i = next_.fetch_add(1, std::memory_order_relaxed))
+            {
+                try
+                {
+                    job(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!error_)
+                    {
+                        error_ = std::current_exception();
+                    }
+                }
+                ++finished;
+            }
+            flag = outer;
+
+            if (finished > 0)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                completed_ += finished;
+            }
+        }
+
+        std::vector<std::thread> workers_;
+
+        std::mutex run_mutex_; // One job at a time
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+
+        std::deque<std::function<void()>> tasks_; // Queued by post()
+        std::function<void(size_t)> *job_ = nullptr;
+        size_t job_count_ = 0;
+        std::atomic<size_t> next_{0};
+        size_t completed_ = 0;
+        size_t active_ = 0;
+        uint64_t generation_ = 0;
+        std::exception_ptr error_;
+        bool stop_ = false;
+    };
+} // namespace audio
@@ -6,9 +6,14 @@
 #include <cstring>
 #include <cmath>
 
+#include <array>
 #include <vector>
 #include <memory>
 #include <string>
+#include <span>
+#include <iterator>
+#include <limits>
+#include <type_traits>
 
 #include <exception>
 #include <stdexcept>
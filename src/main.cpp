@@ -6,6 +6,7 @@
 #include "Effects/BasicEffects.hpp"
 #include "DSP/BiQuadFilter.hpp"
 #include "DSP/FilterDesign.hpp"
+#include "DSP/Denormals.hpp"
 
 using namespace audio;
 
@@ -139,9 +140,13 @@ int main(int argc, char *argv[])
 
         // Process audio through all filters
         std::cout << "\nProcessing audio...\n";
-        for (auto &filter : filters)
         {
-            filter->process(buffer);
+            // Keep silent tails from dropping the IIR chain into denormal arithmetic
+            dsp::ScopedNoDenormals no_denormals;
+            for (auto &filter : filters)
+            {
+                filter->process(buffer);
+            }
         }
 
         // Write output file
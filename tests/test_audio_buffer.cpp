@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "AudioBuffer.hpp"
+#include "SharedAudioBuffer.hpp"
 #include <stdexcept>
 
 using namespace audio;
@@ -290,3 +291,318 @@ TEST_F(AudioBufferTest, ConstPointerAccessWorks)
 
     EXPECT_FLOAT_EQ(data[0], 0.7f);
 }
+
+// Span and frame accessors
+TEST_F(AudioBufferTest, SamplesSpanCoversWholeBuffer)
+{
+    AudioBuffer<float> buffer(10, 2);
+    auto samples = buffer.samples();
+
+    EXPECT_EQ(samples.size(), 20);
+    EXPECT_EQ(samples.data(), buffer.data());
+}
+
+TEST_F(AudioBufferTest, FrameSpanWorks)
+{
+    AudioBuffer<float> buffer(10, 2);
+    auto frame = buffer.frame(3);
+    frame[0] = 0.25f;
+    frame[1] = -0.25f;
+
+    EXPECT_EQ(frame.size(), 2);
+    EXPECT_FLOAT_EQ(buffer(3, 0), 0.25f);
+    EXPECT_FLOAT_EQ(buffer(3, 1), -0.25f);
+    EXPECT_THROW(buffer.frame(10), std::out_of_range);
+}
+
+TEST_F(AudioBufferTest, ChannelViewIsStrided)
+{
+    AudioBuffer<float> buffer(10, 3);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        buffer(i, 1) = static_cast<float>(i);
+    }
+
+    auto view = buffer.channel(1);
+
+    EXPECT_EQ(view.size(), 10);
+    EXPECT_EQ(view.stride(), 3);
+    for (size_t i = 0; i < view.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(view[i], static_cast<float>(i));
+    }
+    EXPECT_THROW(buffer.channel(3), std::out_of_range);
+}
+
+TEST_F(AudioBufferTest, FrameIteratorVisitsAllFrames)
+{
+    AudioBuffer<float> buffer(8, 2);
+
+    size_t count = 0;
+    for (auto frame : buffer.frames())
+    {
+        frame[0] = static_cast<float>(count);
+        frame[1] = -static_cast<float>(count);
+        ++count;
+    }
+
+    EXPECT_EQ(count, 8);
+    EXPECT_EQ(buffer.frames().end() - buffer.frames().begin(), 8);
+    EXPECT_FLOAT_EQ(buffer(5, 0), 5.0f);
+    EXPECT_FLOAT_EQ(buffer(5, 1), -5.0f);
+}
+
+TEST_F(AudioBufferTest, FrameBlockIsCheckedOnce)
+{
+    AudioBuffer<float> buffer(8, 2);
+
+    auto block = buffer.frames(2, 4);
+    EXPECT_EQ(block.size(), 4);
+    block[0][1] = 1.0f;
+    EXPECT_FLOAT_EQ(buffer.at_unchecked(2, 1), 1.0f);
+
+    EXPECT_THROW(buffer.frames(6, 3), std::out_of_range);
+    EXPECT_NO_THROW(buffer.frames(8, 0));
+}
+
+// Compile-time channel count buffers
+TEST_F(AudioBufferTest, FixedChannelBufferWorks)
+{
+    StereoBuffer<float> buffer(16);
+
+    static_assert(StereoBuffer<float>::num_channels() == 2);
+    static_assert(decltype(buffer.frame(0))::extent == 2);
+
+    EXPECT_EQ(buffer.num_samples(), 16);
+    EXPECT_EQ(buffer.total_samples(), 32);
+
+    for (auto frame : buffer.frames())
+    {
+        frame[0] = 1.0f;
+        frame[1] = -1.0f;
+    }
+
+    // Read-only dynamic view; no mutable base reference can change the layout
+    static_assert(!std::is_convertible_v<StereoBuffer<float> &, AudioBuffer<float> &>);
+    const AudioBuffer<float> &dynamic = buffer.dynamic();
+    EXPECT_EQ(dynamic.num_channels(), 2);
+    EXPECT_FLOAT_EQ(dynamic(15, 1), -1.0f);
+
+    // Released to a dynamic buffer for an effect and adopted back without copies
+    const float *storage = buffer.data();
+    AudioBuffer<float> work = std::move(buffer).release();
+    EXPECT_EQ(work.data(), storage);
+    work.apply_gain(0.5f);
+    buffer = StereoBuffer<float>(std::move(work));
+    EXPECT_EQ(buffer.data(), storage);
+    EXPECT_FLOAT_EQ(buffer(15, 1), -0.5f);
+}
+
+TEST_F(AudioBufferTest, FixedChannelBufferDefaultStateIsValid)
+{
+    StereoBuffer<float> buffer;
+    EXPECT_EQ(buffer.num_channels(), 2);
+    EXPECT_EQ(buffer.total_samples(), 0);
+    EXPECT_EQ(buffer.frames().size(), 0);
+    EXPECT_EQ(buffer.frames().num_channels(), 2);
+
+    buffer.resize(4);
+    EXPECT_EQ(buffer.frames().size(), 4);
+    EXPECT_THROW(buffer.resize(4, 3), std::invalid_argument);
+}
+
+TEST_F(AudioBufferTest, FixedChannelBufferRejectsWrongLayout)
+{
+    EXPECT_THROW((AudioBuffer<float, 2>(16, 3)), std::invalid_argument);
+    EXPECT_THROW((AudioBuffer<float, 2>(AudioBuffer<float>(16, 1))), std::invalid_argument);
+
+    AudioBuffer<float, 2> adopted(AudioBuffer<float>(16, 2));
+    EXPECT_EQ(adopted.num_samples(), 16);
+}
+
+TEST_F(AudioBufferTest, DispatchChannelsPicksSpecialisation)
+{
+    auto extent_for = [](size_t n)
+    {
+        return dispatch_channels(n, [](auto channels)
+                                 { return decltype(channels)::value; });
+    };
+
+    EXPECT_EQ(extent_for(1), 1);
+    EXPECT_EQ(extent_for(2), 2);
+    EXPECT_EQ(extent_for(4), 4);
+    EXPECT_EQ(extent_for(8), 8);
+    EXPECT_EQ(extent_for(6), dynamic_channels);
+    EXPECT_EQ(resolve_channels<dynamic_channels>(6), 6);
+}
+
+// Copy-on-write shared buffers
+TEST_F(AudioBufferTest, SharedBufferCopiesShareStorage)
+{
+    SharedAudioBuffer<float> source(AudioBuffer<float>(64, 2));
+    SharedAudioBuffer<float> branch_a = source;
+    SharedAudioBuffer<float> branch_b = source;
+
+    EXPECT_EQ(source.use_count(), 3);
+    EXPECT_TRUE(branch_a.shares_with(branch_b));
+    EXPECT_EQ(branch_a.read().data(), source.read().data());
+}
+
+TEST_F(AudioBufferTest, SharedBufferDetachesOnWrite)
+{
+    AudioBuffer<float> original(64, 2);
+    original(0, 0) = 0.5f;
+
+    SharedAudioBuffer<float> source(std::move(original));
+    SharedAudioBuffer<float> branch = source;
+
+    branch.write()(0, 0) = -1.0f;
+
+    EXPECT_FALSE(branch.shares_with(source));
+    EXPECT_FALSE(source.is_shared());
+    EXPECT_FLOAT_EQ(source.read()(0, 0), 0.5f);
+    EXPECT_FLOAT_EQ(branch.read()(0, 0), -1.0f);
+
+    // Sole owner writes in place
+    const float *before = branch.read().data();
+    branch.write()(1, 1) = 0.25f;
+    EXPECT_EQ(branch.read().data(), before);
+}
+
+TEST_F(AudioBufferTest, SharedBufferReleaseAndEmpty)
+{
+    SharedAudioBuffer<float> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.num_samples(), 0);
+
+    SharedAudioBuffer<float> handle(32, 1);
+    SharedAudioBuffer<float> other = handle;
+
+    AudioBuffer<float> copy = handle.release();
+    EXPECT_EQ(copy.num_samples(), 32);
+    EXPECT_TRUE(handle.empty());
+    EXPECT_EQ(other.num_samples(), 32);
+}
+
+// Gain and mix kernels
+TEST_F(AudioBufferTest, ApplyGainRampWorks)
+{
+    AudioBuffer<float> buffer(4, 2);
+    for (auto &sample : buffer.samples())
+    {
+        sample = 1.0f;
+    }
+
+    buffer.apply_gain_ramp(0.0f, 1.0f);
+
+    // Frame i gets i / num_frames, both channels alike
+    for (size_t i = 0; i < 4; ++i)
+    {
+        EXPECT_FLOAT_EQ(buffer(i, 0), i * 0.25f);
+        EXPECT_FLOAT_EQ(buffer(i, 1), i * 0.25f);
+    }
+}
+
+TEST_F(AudioBufferTest, MixRampWorks)
+{
+    AudioBuffer<float> dest(4, 1);
+    AudioBuffer<float> source(4, 1);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        source(i, 0) = 1.0f;
+    }
+
+    dest.mix_ramp(source, 1.0f, 0.0f);
+
+    EXPECT_FLOAT_EQ(dest(0, 0), 1.0f);
+    EXPECT_FLOAT_EQ(dest(2, 0), 0.5f);
+    EXPECT_THROW(dest.mix_ramp(AudioBuffer<float>(3, 1), 1.0f, 0.0f), std::invalid_argument);
+}
+
+TEST_F(AudioBufferTest, Int16GainSaturates)
+{
+    AudioBuffer<int16_t> buffer(3, 1);
+    buffer(0, 0) = 20000;
+    buffer(1, 0) = -20000;
+    buffer(2, 0) = 100;
+
+    buffer.apply_gain(2.0f);
+
+    EXPECT_EQ(buffer(0, 0), 32767);
+    EXPECT_EQ(buffer(1, 0), -32768);
+    EXPECT_EQ(buffer(2, 0), 200);
+
+    AudioBuffer<int16_t> other(3, 1);
+    other(0, 0) = 1000;
+    buffer.mix(other);
+    EXPECT_EQ(buffer(0, 0), 32767);
+}
+
+TEST_F(AudioBufferTest, Int32MixSaturates)
+{
+    AudioBuffer<int32_t> buffer(1, 1);
+    AudioBuffer<int32_t> other(1, 1);
+    buffer(0, 0) = std::numeric_limits<int32_t>::max() - 10;
+    other(0, 0) = 1000;
+
+    buffer.mix(other);
+
+    EXPECT_EQ(buffer(0, 0), std::numeric_limits<int32_t>::max());
+}
+
+// Interleave and channel routing
+TEST_F(AudioBufferTest, PlanarRoundTripAllLayouts)
+{
+    // 12 channels exercises the generic (7.1.4) path
+    for (size_t channels : {1u, 2u, 3u, 4u, 6u, 8u, 12u})
+    {
+        AudioBuffer<float> buffer(100, channels);
+        for (size_t i = 0; i < buffer.total_samples(); ++i)
+        {
+            buffer.data()[i] = static_cast<float>(i);
+        }
+
+        std::vector<std::vector<float>> planar(channels, std::vector<float>(100));
+        std::vector<float *> pointers;
+        for (auto &channel : planar)
+        {
+            pointers.push_back(channel.data());
+        }
+
+        buffer.copy_to_planar(pointers.data());
+        for (size_t ch = 0; ch < channels; ++ch)
+        {
+            EXPECT_FLOAT_EQ(planar[ch][7], buffer(7, ch));
+        }
+
+        AudioBuffer<float> rebuilt(100, channels);
+        rebuilt.copy_from_planar(pointers.data());
+        for (size_t i = 0; i < buffer.total_samples(); ++i)
+        {
+            ASSERT_FLOAT_EQ(rebuilt.data()[i], buffer.data()[i]);
+        }
+    }
+}
+
+TEST_F(AudioBufferTest, RemapChannelsReordersAndDuplicates)
+{
+    AudioBuffer<float> buffer(70, 3);
+    for (size_t i = 0; i < 70; ++i)
+    {
+        buffer(i, 0) = 1.0f;
+        buffer(i, 1) = 2.0f;
+        buffer(i, 2) = 3.0f;
+    }
+
+    const size_t map[] = {2, 0, 0, 1};
+    auto remapped = buffer.remap_channels(map);
+
+    EXPECT_EQ(remapped.num_channels(), 4);
+    EXPECT_FLOAT_EQ(remapped(69, 0), 3.0f);
+    EXPECT_FLOAT_EQ(remapped(69, 1), 1.0f);
+    EXPECT_FLOAT_EQ(remapped(69, 2), 1.0f);
+    EXPECT_FLOAT_EQ(remapped(69, 3), 2.0f);
+
+    const size_t bad_map[] = {3};
+    EXPECT_THROW(buffer.remap_channels(bad_map), std::out_of_range);
+}
@@ -193,6 +193,28 @@ TEST_F(BasicEffectsTest, FadeEffectStereo)
     EXPECT_NEAR(test(0, 1), 0.0f, 0.1f);
 }
 
+TEST_F(BasicEffectsTest, FadeHoldsEndGainAfterRamp)
+{
+    // 10-sample fade in on a 40-sample buffer
+    FadeEffect<float> fade(1000.0, 0.01, FadeEffect<float>::Type::FadeIn);
+
+    AudioBuffer<float> test(40, 2);
+    for (auto &sample : test.samples())
+    {
+        sample = 1.0f;
+    }
+
+    fade.process(test);
+
+    EXPECT_FLOAT_EQ(test(0, 0), 0.0f);
+    EXPECT_FLOAT_EQ(test(5, 1), 0.5f);
+    for (size_t i = 10; i < 40; ++i)
+    {
+        EXPECT_FLOAT_EQ(test(i, 0), 1.0f);
+        EXPECT_FLOAT_EQ(test(i, 1), 1.0f);
+    }
+}
+
 // Mix Effect Tests
 TEST_F(BasicEffectsTest, MixEffectAdd)
 {
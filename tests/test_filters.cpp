@@ -1,11 +1,30 @@
 #include <gtest/gtest.h>
 #include "DSP/BiQuadFilter.hpp"
 #include "DSP/FilterDesign.hpp"
+#include "DSP/CoefficientCache.hpp"
+#include "DSP/ParallelIIR.hpp"
+#include "DSP/CascadeDesign.hpp"
+#include "DSP/FFT.hpp"
+#include "DSP/FIRFilter.hpp"
+#include "DSP/FIRDesign.hpp"
+#include "DSP/ZeroPhase.hpp"
+#include "DSP/FrequencyResponse.hpp"
+#include "DSP/Resampler.hpp"
+#include "DSP/StateVariableFilter.hpp"
+#include "DSP/FixedBiquad.hpp"
+#include "DSP/FixedPointBiquad.hpp"
+#include "DSP/MultiStreamBiquad.hpp"
+#include "DSP/LinearPhaseBuilder.hpp"
 #include "Effects/FilterEffects.hpp"
-#include "Effects/equalizer.hpp"
+#include "Effects/Equalizer.hpp"
+#include "Effects/Oversampled.hpp"
+#include "Effects/Crossover.hpp"
+#include "Effects/BasicEffects.hpp"
 #include "AudioBuffer.hpp"
 #include <cmath>
 #include <complex>
+#include <numeric>
+#include <thread>
 
 using namespace audio;
 using namespace audio::dsp;
@@ -494,3 +513,2178 @@ TEST_F(FilterTest, FilterStabilityImpulse)
         EXPECT_TRUE(std::isfinite(output));
     }
 }
+
+TEST_F(FilterTest, BiquadFilterChannelSpecialisationsMatch)
+{
+    auto coeffs = FilterDesign::lowpass(SAMPLE_RATE, 1000.0);
+
+    // 3 channels take the dynamic path, 4 channels the fixed one
+    for (size_t channels : {1u, 2u, 3u, 4u, 8u})
+    {
+        auto buffer = generate_sine(440.0, 0.01, channels);
+        auto reference = buffer;
+
+        BiquadFilter<float> block_filter(coeffs);
+        block_filter.process_buffer(buffer.data(), buffer.num_samples(), buffer.num_channels());
+
+        BiquadFilter<float> sample_filter(coeffs);
+        for (size_t i = 0; i < reference.num_samples(); ++i)
+        {
+            for (size_t ch = 0; ch < channels; ++ch)
+            {
+                reference(i, ch) = sample_filter.process_sample(reference(i, ch), ch);
+            }
+        }
+
+        for (size_t i = 0; i < buffer.total_samples(); ++i)
+        {
+            ASSERT_FLOAT_EQ(buffer.data()[i], reference.data()[i]);
+        }
+    }
+}
+
+TEST_F(FilterTest, BiquadFilterWideLayoutsMatchPerSample)
+{
+    auto coeffs = FilterDesign::highpass(SAMPLE_RATE, 300.0);
+
+    // 12 and 15 channels split into 8 + 4 and 8 + 4 + 2 + 1 lane groups
+    for (size_t channels : {12u, 15u})
+    {
+        AudioBuffer<double> buffer(200, channels);
+        for (size_t i = 0; i < buffer.total_samples(); ++i)
+        {
+            buffer.data()[i] = std::sin(0.01 * static_cast<double>(i));
+        }
+        auto reference = buffer;
+
+        BiquadFilter<double> block_filter(coeffs);
+        block_filter.process_buffer(buffer.data(), 100, channels);
+        block_filter.process_buffer(buffer.data() + 100 * channels, 100, channels);
+
+        BiquadFilter<double> sample_filter(coeffs);
+        for (size_t i = 0; i < reference.num_samples(); ++i)
+        {
+            for (size_t ch = 0; ch < channels; ++ch)
+            {
+                reference(i, ch) = sample_filter.process_sample(reference(i, ch), ch);
+            }
+        }
+
+        for (size_t i = 0; i < buffer.total_samples(); ++i)
+        {
+            ASSERT_NEAR(buffer.data()[i], reference.data()[i], 1e-12);
+        }
+    }
+}
+
+TEST_F(FilterTest, BiquadFilterStateRoundTrip)
+{
+    BiquadFilter<float> filter(FilterDesign::lowpass(SAMPLE_RATE, 1000.0));
+    filter.prepare(2);
+    EXPECT_EQ(filter.num_channels(), 2);
+
+    filter.process_sample(1.0f, 1);
+    BiquadState saved = filter.state(1);
+    EXPECT_DOUBLE_EQ(saved.x1, 1.0);
+
+    float next = filter.process_sample(0.5f, 1);
+    filter.set_state(1, saved);
+    EXPECT_FLOAT_EQ(filter.process_sample(0.5f, 1), next);
+}
+
+// Biquad cascade tests
+TEST_F(FilterTest, BiquadCascadeMatchesSeparatePasses)
+{
+    std::vector<BiquadCoefficients> sections = {
+        FilterDesign::peaking_eq(SAMPLE_RATE, 100.0, 4.0, 1.0),
+        FilterDesign::peaking_eq(SAMPLE_RATE, 1000.0, -3.0, 0.5),
+        FilterDesign::high_shelf(SAMPLE_RATE, 6000.0, 2.0)};
+
+    // Long enough to span several cascade blocks
+    auto fused = generate_sine(440.0, 0.5, 2);
+    auto separate = fused;
+
+    BiquadCascade<float> cascade(sections);
+    cascade.process_buffer(fused.data(), fused.num_samples(), fused.num_channels());
+
+    for (const auto &coeffs : sections)
+    {
+        BiquadFilter<float> filter(coeffs);
+        filter.process_buffer(separate.data(), separate.num_samples(), separate.num_channels());
+    }
+
+    for (size_t i = 0; i < fused.total_samples(); ++i)
+    {
+        ASSERT_FLOAT_EQ(fused.data()[i], separate.data()[i]);
+    }
+}
+
+TEST_F(FilterTest, BiquadCascadeSkipsDisabledSections)
+{
+    BiquadCascade<float> cascade;
+    size_t idx = cascade.add_section(FilterDesign::lowpass(SAMPLE_RATE, 100.0));
+    EXPECT_EQ(cascade.num_sections(), 1);
+
+    cascade.set_section_enabled(idx, false);
+    EXPECT_FALSE(cascade.is_section_enabled(idx));
+
+    auto signal = generate_sine(5000.0, 0.05);
+    auto original = signal;
+    cascade.process_buffer(signal.data(), signal.num_samples(), signal.num_channels());
+
+    for (size_t i = 0; i < signal.num_samples(); ++i)
+    {
+        ASSERT_FLOAT_EQ(signal(i, 0), original(i, 0));
+    }
+}
+
+TEST_F(FilterTest, Equalizer10BandMatchesIndividualBands)
+{
+    Equalizer<float> eq(SAMPLE_RATE);
+    eq.create_10band_eq();
+    for (size_t i = 0; i < eq.num_bands(); ++i)
+    {
+        eq.set_band_gain(i, (i % 2 == 0) ? 3.0 : -2.0);
+    }
+
+    auto fused = generate_sine(1000.0, 0.2, 2);
+    auto separate = fused;
+    eq.process(fused);
+
+    for (size_t i = 0; i < eq.num_bands(); ++i)
+    {
+        const auto &band = eq.get_band(i);
+        ParametricEQBand<float> single(SAMPLE_RATE, band.frequency, band.gain_db, band.bandwidth);
+        single.process(separate);
+    }
+
+    for (size_t i = 0; i < fused.total_samples(); ++i)
+    {
+        ASSERT_FLOAT_EQ(fused.data()[i], separate.data()[i]);
+    }
+}
+
+// Precision / topology policy tests
+namespace
+{
+    // Max absolute error of a policy against the reference DoubleDF1 filter
+    template <typename Policy>
+    double max_policy_error(const BiquadCoefficients &coeffs, size_t num_samples)
+    {
+        BiquadFilter<double> reference(coeffs);
+        BiquadFilter<double, Policy> candidate(coeffs);
+
+        uint32_t seed = 12345;
+        double max_error = 0.0;
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            double x = static_cast<double>(seed) / 4294967296.0 - 0.5;
+            max_error = std::max(max_error, std::abs(reference.process_sample(x) - candidate.process_sample(x)));
+        }
+        return max_error;
+    }
+}
+
+TEST_F(FilterTest, DoubleTDF2MatchesDF1)
+{
+    auto coeffs = FilterDesign::lowpass(SAMPLE_RATE, 1000.0);
+    EXPECT_LT(max_policy_error<DoubleTDF2>(coeffs, 20000), 1e-12);
+
+    // Sub-50 Hz at a high sample rate
+    auto low = FilterDesign::highpass(192000.0, 20.0);
+    EXPECT_LT(max_policy_error<DoubleTDF2>(low, 20000), 1e-9);
+}
+
+TEST_F(FilterTest, FloatTDF2ErrorIsBounded)
+{
+    // Mid-band filter: float error stays near float resolution
+    auto coeffs = FilterDesign::peaking_eq(SAMPLE_RATE, 1000.0, 6.0, 1.0);
+    EXPECT_LT(max_policy_error<FloatTDF2>(coeffs, 20000), 1e-5);
+
+    auto lowpass = FilterDesign::lowpass(SAMPLE_RATE, 1000.0);
+    EXPECT_LT(max_policy_error<FloatTDF2>(lowpass, 20000), 1e-5);
+}
+
+TEST_F(FilterTest, FloatPolicyEffectsProcess)
+{
+    auto signal = generate_sine(200.0, 0.1, 2);
+    auto reference = signal;
+
+    LowpassEffect<float, FloatTDF2> fast(SAMPLE_RATE, 1000.0);
+    LowpassEffect<float> exact(SAMPLE_RATE, 1000.0);
+    fast.process(signal);
+    exact.process(reference);
+
+    for (size_t i = 0; i < signal.total_samples(); ++i)
+    {
+        ASSERT_NEAR(signal.data()[i], reference.data()[i], 1e-5);
+    }
+
+    Equalizer<float, FloatTDF2> eq(SAMPLE_RATE);
+    eq.add_band(1000.0, 6.0);
+    EXPECT_NO_THROW(eq.process(signal));
+}
+
+TEST_F(FilterTest, TDF2SetStateFromDF1)
+{
+    auto coeffs = FilterDesign::lowpass(SAMPLE_RATE, 2000.0);
+    BiquadFilter<double> df1(coeffs);
+    BiquadFilter<double, DoubleTDF2> tdf2(coeffs);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        df1.process_sample(std::sin(0.1 * i));
+    }
+    tdf2.set_state(0, df1.state(0));
+
+    for (int i = 50; i < 100; ++i)
+    {
+        double x = std::sin(0.1 * i);
+        ASSERT_NEAR(df1.process_sample(x), tdf2.process_sample(x), 1e-12);
+    }
+}
+
+// Denormal protection tests
+TEST_F(FilterTest, ScopedNoDenormalsFlushesAndRestores)
+{
+    volatile float tiny = std::numeric_limits<float>::min();
+
+    {
+        ScopedNoDenormals guard;
+        float result = tiny * 0.5f;
+        if (ScopedNoDenormals::is_supported())
+        {
+            EXPECT_EQ(result, 0.0f);
+        }
+    }
+
+    // Previous mode restored: gradual underflow is back
+    float result = tiny * 0.5f;
+    EXPECT_GT(result, 0.0f);
+    EXPECT_EQ(std::fpclassify(result), FP_SUBNORMAL);
+}
+
+TEST_F(FilterTest, FlushDenormalSnapsTinyValues)
+{
+    EXPECT_EQ(flush_denormal(1e-30), 0.0);
+    EXPECT_EQ(flush_denormal(1e-20f), 0.0f);
+    EXPECT_EQ(flush_denormal(1e-3), 1e-3);
+    EXPECT_EQ(flush_denormal<int16_t>(1), 1);
+}
+
+TEST_F(FilterTest, FilterStateDecaysToZeroOnSilence)
+{
+    BiquadFilter<float> filter(FilterDesign::lowpass(SAMPLE_RATE, 1000.0));
+
+    auto loud = generate_sine(440.0, 0.05);
+    filter.process_buffer(loud.data(), loud.num_samples(), 1);
+
+    AudioBuffer<float> silence(static_cast<size_t>(SAMPLE_RATE), 1);
+    filter.process_buffer(silence.data(), silence.num_samples(), 1);
+
+    BiquadState state = filter.state(0);
+    EXPECT_EQ(state.y1, 0.0);
+    EXPECT_EQ(state.y2, 0.0);
+}
+
+TEST_F(FilterTest, FilterStateStaysNormalWithoutFlushToZero)
+{
+#if defined(AUDIO_HAS_MXCSR)
+    // Gradual underflow on, as on a thread nobody configured
+    const unsigned int saved_csr = _mm_getcsr();
+    _mm_setcsr(saved_csr & ~0x8040u);
+#endif
+
+    BiquadFilter<float> df1(FilterDesign::lowpass(SAMPLE_RATE, 200.0));
+    BiquadFilter<float, FloatTDF2> tdf2(FilterDesign::lowpass(SAMPLE_RATE, 200.0));
+    StateVariableFilter<float> svf(SAMPLE_RATE, 200.0);
+
+    // Impulse, then a second of silence in small blocks
+    size_t subnormal_outputs = 0;
+    for (size_t block = 0; block < 700; ++block)
+    {
+        float a[64] = {}, b[64] = {}, c[64] = {};
+        a[0] = b[0] = c[0] = block == 0 ? 1.0f : 0.0f;
+        df1.process_buffer(a, 64, 1);
+        tdf2.process_buffer(b, 64, 1);
+        svf.process_buffer(c, 64, 1);
+        for (size_t n = 0; n < 64; ++n)
+        {
+            subnormal_outputs += std::fpclassify(a[n]) == FP_SUBNORMAL;
+            subnormal_outputs += std::fpclassify(b[n]) == FP_SUBNORMAL;
+            subnormal_outputs += std::fpclassify(c[n]) == FP_SUBNORMAL;
+        }
+    }
+
+#if defined(AUDIO_HAS_MXCSR)
+    _mm_setcsr(saved_csr);
+#endif
+
+    EXPECT_EQ(subnormal_outputs, 0u);
+    EXPECT_EQ(df1.state(0).y1, 0.0);
+    EXPECT_EQ(df1.state(0).y2, 0.0);
+}
+
+// Coefficient smoothing tests
+TEST_F(FilterTest, CoefficientRampLandsOnTarget)
+{
+    auto from = FilterDesign::lowpass(SAMPLE_RATE, 500.0);
+    auto to = FilterDesign::lowpass(SAMPLE_RATE, 5000.0);
+
+    BiquadFilter<float> ramped(from);
+    BiquadFilter<float> instant(to);
+    ramped.set_coefficients(to, 256);
+    EXPECT_TRUE(ramped.is_ramping());
+
+    // Ramp spans several blocks; afterwards both filters share coefficients
+    auto signal = generate_sine(440.0, 0.1);
+    for (size_t start = 0; start < 512; start += 100)
+    {
+        ramped.process_buffer(signal.data() + start, std::min<size_t>(100, 512 - start), 1);
+    }
+    EXPECT_FALSE(ramped.is_ramping());
+
+    // Landed exactly on the target: from a clean state both filters agree
+    ramped.reset();
+    auto a = generate_sine(1000.0, 0.01);
+    auto b = a;
+    ramped.process_buffer(a.data(), a.num_samples(), 1);
+    instant.process_buffer(b.data(), b.num_samples(), 1);
+    for (size_t i = 0; i < a.num_samples(); ++i)
+    {
+        ASSERT_EQ(a.data()[i], b.data()[i]);
+    }
+}
+
+TEST_F(FilterTest, ZeroRampSwitchesImmediately)
+{
+    auto to = FilterDesign::highpass(SAMPLE_RATE, 2000.0);
+    BiquadFilter<float> ramped(FilterDesign::lowpass(SAMPLE_RATE, 500.0));
+    BiquadFilter<float> instant(to);
+    ramped.set_coefficients(to, 0);
+    EXPECT_FALSE(ramped.is_ramping());
+
+    auto a = generate_sine(1000.0, 0.01);
+    auto b = a;
+    ramped.process_buffer(a.data(), a.num_samples(), 1);
+    instant.process_buffer(b.data(), b.num_samples(), 1);
+    for (size_t i = 0; i < a.num_samples(); ++i)
+    {
+        ASSERT_EQ(a.data()[i], b.data()[i]);
+    }
+}
+
+TEST_F(FilterTest, SmoothedSweepAvoidsSteps)
+{
+    // Block-rate cutoff automation on a steady tone
+    auto run_sweep = [&](double smoothing)
+    {
+        LowpassEffect<float> lpf(SAMPLE_RATE, 200.0);
+        lpf.set_smoothing_time(smoothing);
+        auto signal = generate_sine(1000.0, 0.2);
+
+        const size_t block = 256;
+        float max_step = 0.0f;
+        float previous = 0.0f;
+        for (size_t start = 0; start + block <= signal.num_samples(); start += block)
+        {
+            lpf.set_cutoff(start % (2 * block) == 0 ? 200.0 : 8000.0);
+
+            AudioBuffer<float> chunk(block, 1);
+            for (size_t i = 0; i < block; ++i)
+            {
+                chunk.data()[i] = signal.data()[start + i];
+            }
+            lpf.process(chunk);
+
+            for (size_t i = 0; i < block; ++i)
+            {
+                max_step = std::max(max_step, std::abs(chunk.data()[i] - previous));
+                previous = chunk.data()[i];
+            }
+        }
+        return max_step;
+    };
+
+    float hard = run_sweep(0.0);
+    float smooth = run_sweep(256.0 / SAMPLE_RATE);
+    EXPECT_LT(smooth, hard);
+}
+
+// Coefficient cache and fast design tests
+TEST_F(FilterTest, FastFilterDesignMatchesExact)
+{
+    auto expect_close = [](const BiquadCoefficients &a, const BiquadCoefficients &b)
+    {
+        EXPECT_NEAR(a.b0, b.b0, 1e-8);
+        EXPECT_NEAR(a.b1, b.b1, 1e-8);
+        EXPECT_NEAR(a.b2, b.b2, 1e-8);
+        EXPECT_NEAR(a.a1, b.a1, 1e-8);
+        EXPECT_NEAR(a.a2, b.a2, 1e-8);
+    };
+
+    for (double freq : {20.0, 250.0, 1000.0, 8000.0, 20000.0})
+    {
+        expect_close(FastFilterDesign::lowpass(SAMPLE_RATE, freq, 0.707), FilterDesign::lowpass(SAMPLE_RATE, freq, 0.707));
+        expect_close(FastFilterDesign::highpass(SAMPLE_RATE, freq, 4.0), FilterDesign::highpass(SAMPLE_RATE, freq, 4.0));
+        expect_close(FastFilterDesign::bandpass(SAMPLE_RATE, freq, 0.3), FilterDesign::bandpass(SAMPLE_RATE, freq, 0.3));
+        expect_close(FastFilterDesign::peaking_eq(SAMPLE_RATE, freq, -12.0, 2.0), FilterDesign::peaking_eq(SAMPLE_RATE, freq, -12.0, 2.0));
+        expect_close(FastFilterDesign::low_shelf(SAMPLE_RATE, freq, 9.0), FilterDesign::low_shelf(SAMPLE_RATE, freq, 9.0));
+        expect_close(FastFilterDesign::high_shelf(SAMPLE_RATE, freq, -6.0), FilterDesign::high_shelf(SAMPLE_RATE, freq, -6.0));
+    }
+}
+
+TEST_F(FilterTest, FastMathErrorBounds)
+{
+    for (double x = 0.0; x <= PI; x += 0.001)
+    {
+        double s, c;
+        FastMath::sin_cos(x, s, c);
+        ASSERT_NEAR(s, std::sin(x), 1e-11);
+        ASSERT_NEAR(c, std::cos(x), 1e-11);
+    }
+    for (double x = -20.0; x <= 20.0; x += 0.01)
+    {
+        ASSERT_NEAR(FastMath::exp(x) / std::exp(x), 1.0, 1e-9);
+        ASSERT_NEAR(FastMath::sinh(x), std::sinh(x), 1e-9 * std::max(1e-3, std::abs(std::sinh(x))));
+    }
+}
+
+TEST_F(FilterTest, CoefficientCacheHitsAndEvicts)
+{
+    CoefficientCache cache(2);
+    FilterSpec a{FilterType::Lowpass, SAMPLE_RATE, 1000.0, 0.707};
+    FilterSpec b{FilterType::PeakingEQ, SAMPLE_RATE, 1000.0, 1.0, 6.0};
+    FilterSpec c{FilterType::HighShelf, SAMPLE_RATE, 5000.0, 1.0, -3.0};
+
+    auto first = cache.get(a);
+    auto again = cache.get(a);
+    EXPECT_EQ(cache.misses(), 1u);
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(again.b0, first.b0);
+    EXPECT_EQ(first.a1, FilterDesign::lowpass(SAMPLE_RATE, 1000.0, 0.707).a1);
+
+    cache.get(b);
+    cache.get(a); // a is now most recent, b is evicted next
+    cache.get(c);
+    EXPECT_EQ(cache.size(), 2u);
+
+    size_t misses = cache.misses();
+    cache.get(a);
+    EXPECT_EQ(cache.misses(), misses);
+    cache.get(b);
+    EXPECT_EQ(cache.misses(), misses + 1);
+}
+
+TEST_F(FilterTest, CoefficientCacheRejectsInvalidSpecs)
+{
+    CoefficientCache cache(4);
+    EXPECT_THROW(cache.get({FilterType::Lowpass, SAMPLE_RATE, SAMPLE_RATE, 0.707}), std::invalid_argument);
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_THROW(CoefficientCache(0), std::invalid_argument);
+
+    // Non-finite fields throw even where the design would not range-check them
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_THROW(cache.get({FilterType::PeakingEQ, SAMPLE_RATE, 1000.0, 1.0, nan}), std::invalid_argument);
+        EXPECT_THROW(cache.get({FilterType::Lowpass, SAMPLE_RATE, 1000.0, 0.707, nan}), std::invalid_argument);
+        EXPECT_THROW(cache.get({FilterType::LowShelf, SAMPLE_RATE, 200.0, 1.0, inf}), std::invalid_argument);
+    }
+    EXPECT_EQ(cache.size(), 0u);
+
+    // Shapes without a gain share one entry whatever gain_db holds
+    const auto flat = cache.get({FilterType::Lowpass, SAMPLE_RATE, 1000.0, 0.707, 0.0});
+    const auto tagged = cache.get({FilterType::Lowpass, SAMPLE_RATE, 1000.0, 0.707, 6.0});
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(tagged.b0, flat.b0);
+    cache.get({FilterType::PeakingEQ, SAMPLE_RATE, 1000.0, 1.0, 6.0});
+    cache.get({FilterType::PeakingEQ, SAMPLE_RATE, 1000.0, 1.0, 3.0});
+    EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST_F(FilterTest, ParameterSweepsBypassSharedCache)
+{
+    LowpassEffect<float> lpf(SAMPLE_RATE, 1000.0);
+    Equalizer<float> eq(SAMPLE_RATE);
+    eq.add_band(1000.0, 3.0, 1.0);
+
+    const size_t size = CoefficientCache::shared().size();
+    const size_t lookups = CoefficientCache::shared().hits() + CoefficientCache::shared().misses();
+    lpf.set_smoothing_time(0.01);
+    for (int i = 0; i < 100; ++i)
+    {
+        lpf.set_cutoff(1000.0 + i);
+        eq.set_band_gain(0, 0.1 * i);
+    }
+    EXPECT_EQ(CoefficientCache::shared().size(), size);
+    EXPECT_EQ(CoefficientCache::shared().hits() + CoefficientCache::shared().misses(), lookups);
+
+    // The glide lands on the target design (fast-math coefficients are within 1e-8)
+    LowpassEffect<float> instant(SAMPLE_RATE, 1099.0);
+    AudioBuffer<float> settle(static_cast<size_t>(0.02 * SAMPLE_RATE), 1);
+    lpf.process(settle);
+    EXPECT_FALSE(lpf.is_smoothing());
+
+    auto a = generate_sine(3000.0, 0.01);
+    auto b = a;
+    lpf.reset();
+    lpf.process(a);
+    instant.process(b);
+    for (size_t i = 0; i < a.num_samples(); ++i)
+    {
+        ASSERT_NEAR(a.data()[i], b.data()[i], 1e-5f);
+    }
+}
+
+// Time-parallel IIR tests
+TEST_F(FilterTest, ThreadPoolRunsEveryIndexOnce)
+{
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallel_for(hits.size(), [&](size_t i)
+                      { hits[i].fetch_add(1); });
+    for (const auto &h : hits)
+    {
+        ASSERT_EQ(h.load(), 1);
+    }
+
+    EXPECT_THROW(pool.parallel_for(8, [](size_t i)
+                                   { if (i == 5) throw std::runtime_error("job failed"); }),
+                 std::runtime_error);
+}
+
+TEST_F(FilterTest, ThreadPoolPostRunsInBackground)
+{
+    std::atomic<int> done{0};
+    std::atomic<bool> off_caller{true};
+    {
+        ThreadPool pool(3);
+        const auto caller = std::this_thread::get_id();
+        for (int i = 0; i < 16; ++i)
+        {
+            pool.post([&]
+                      {
+                          off_caller = off_caller && std::this_thread::get_id() != caller;
+                          done.fetch_add(1); });
+        }
+
+        // Parallel jobs still run while tasks are queued
+        std::vector<std::atomic<int>> hits(100);
+        pool.parallel_for(hits.size(), [&](size_t i)
+                          { hits[i].fetch_add(1); });
+        EXPECT_EQ(std::count_if(hits.begin(), hits.end(), [](const auto &h)
+                                { return h.load() == 1; }),
+                  100);
+    }
+    EXPECT_EQ(done.load(), 16); // Queued tasks finish before the pool is gone
+    EXPECT_TRUE(off_caller);
+
+    // Without workers a task runs inline
+    ThreadPool single(1);
+    bool ran = false;
+    single.post([&]
+                { ran = true; });
+    EXPECT_TRUE(ran);
+}
+
+TEST_F(FilterTest, ParallelBiquadMatchesSerial)
+{
+    ThreadPool pool(4);
+    auto coeffs = FilterDesign::peaking_eq(SAMPLE_RATE, 60.0, 12.0, 0.2); // Slow-decaying resonance
+
+    auto signal = generate_sine(440.0, 3.0);
+    for (size_t i = 0; i < signal.num_samples(); ++i)
+    {
+        signal.data()[i] += 0.3f * std::sin(0.0007f * static_cast<float>(i * i % 100000));
+    }
+    std::vector<double> input(signal.data(), signal.data() + signal.num_samples());
+    std::vector<double> serial = input;
+    std::vector<double> parallel = input;
+
+    BiquadFilter<double> reference(coeffs);
+    ParallelBiquad<double> block(coeffs, pool);
+
+    // Two calls: state has to carry across them too
+    const size_t split = 50000;
+    reference.process_buffer(serial.data(), split, 1);
+    reference.process_buffer(serial.data() + split, serial.size() - split, 1);
+    block.process(parallel.data(), split);
+    block.process(parallel.data() + split, parallel.size() - split);
+
+    for (size_t i = 0; i < serial.size(); ++i)
+    {
+        ASSERT_NEAR(parallel[i], serial[i], 1e-7) << "sample " << i;
+    }
+
+    BiquadState ref_state = reference.state(0);
+    EXPECT_NEAR(block.state().y1, ref_state.y1, 1e-7);
+    EXPECT_NEAR(block.state().y2, ref_state.y2, 1e-7);
+    EXPECT_EQ(block.state().x1, ref_state.x1);
+}
+
+TEST_F(FilterTest, ParallelBiquadFloatWithinTolerance)
+{
+    ThreadPool pool(3);
+    auto coeffs = FilterDesign::lowpass(SAMPLE_RATE, 200.0, 2.0);
+    auto serial = generate_sine(110.0, 2.0);
+    auto parallel = serial;
+
+    BiquadFilter<float> reference(coeffs);
+    ParallelBiquad<float> block(coeffs, pool);
+    reference.process_buffer(serial.data(), serial.num_samples(), 1);
+    block.process(parallel.data(), parallel.num_samples());
+
+    for (size_t i = 0; i < serial.num_samples(); ++i)
+    {
+        ASSERT_NEAR(parallel.data()[i], serial.data()[i], 1e-5f);
+    }
+}
+
+TEST_F(FilterTest, ParallelBiquadInt16SaturatesOnce)
+{
+    ThreadPool pool(4);
+    auto coeffs = FilterDesign::peaking_eq(SAMPLE_RATE, 440.0, 12.0, 1.0);
+
+    // +12 dB on a 30000-amplitude tone overshoots the int16 range
+    const size_t length = 4 * ParallelBiquad<int16_t>::min_segment_length;
+    std::vector<int16_t> samples(length);
+    std::vector<double> reference(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        samples[i] = static_cast<int16_t>(30000.0 * std::sin(TWO_PI * 440.0 * static_cast<double>(i) / SAMPLE_RATE));
+        reference[i] = samples[i];
+    }
+
+    BiquadFilter<double> serial(coeffs);
+    serial.process_buffer(reference.data(), length, 1);
+    ParallelBiquad<int16_t> block(coeffs, pool);
+    block.process(samples.data(), length);
+
+    bool clipped = false;
+    for (size_t i = 0; i < length; ++i)
+    {
+        const auto expected = simd::saturate_cast<int16_t>(reference[i]);
+        ASSERT_NEAR(samples[i], expected, 1) << "sample " << i;
+        clipped |= samples[i] == std::numeric_limits<int16_t>::max();
+    }
+    EXPECT_TRUE(clipped);
+}
+
+// Higher-order cascade design tests
+namespace
+{
+    // Complex response of a section cascade at freq
+    std::complex<double> cascade_response(const std::vector<BiquadCoefficients> &sections, double freq)
+    {
+        const std::complex<double> z1 = std::polar(1.0, -TWO_PI * freq / 44100.0);
+        const std::complex<double> z2 = z1 * z1;
+        std::complex<double> h = 1.0;
+        for (const auto &c : sections)
+        {
+            h *= (c.b0 + c.b1 * z1 + c.b2 * z2) / (1.0 + c.a1 * z1 + c.a2 * z2);
+        }
+        return h;
+    }
+
+    // Magnitude of a section cascade at freq, in dB
+    double cascade_gain_db(const std::vector<BiquadCoefficients> &sections, double freq)
+    {
+        return 20.0 * std::log10(std::abs(cascade_response(sections, freq)));
+    }
+}
+
+TEST_F(FilterTest, ButterworthOrderAndCutoff)
+{
+    for (int order : {1, 2, 3, 5, 8})
+    {
+        auto lp = CascadeDesign::butterworth_lowpass(SAMPLE_RATE, 1000.0, order);
+        auto hp = CascadeDesign::butterworth_highpass(SAMPLE_RATE, 1000.0, order);
+        EXPECT_EQ(lp.size(), static_cast<size_t>((order + 1) / 2));
+
+        EXPECT_NEAR(cascade_gain_db(lp, 1000.0), -3.0103, 1e-3);
+        EXPECT_NEAR(cascade_gain_db(hp, 1000.0), -3.0103, 1e-3);
+        EXPECT_NEAR(cascade_gain_db(lp, 10.0), 0.0, 1e-3);
+        EXPECT_NEAR(cascade_gain_db(hp, 20000.0), 0.0, 1e-2);
+    }
+
+    // 8th order: at least 48 dB down one octave above cutoff
+    auto lp8 = CascadeDesign::butterworth_lowpass(SAMPLE_RATE, 1000.0, 8);
+    EXPECT_LT(cascade_gain_db(lp8, 2000.0), -48.0);
+    EXPECT_LT(lp8.front().a2, lp8.back().a2); // Resonant sections last
+}
+
+TEST_F(FilterTest, LinkwitzRileySumsFlat)
+{
+    for (int order : {2, 4, 8})
+    {
+        auto lp = CascadeDesign::linkwitz_riley_lowpass(SAMPLE_RATE, 2000.0, order);
+        auto hp = CascadeDesign::linkwitz_riley_highpass(SAMPLE_RATE, 2000.0, order);
+        EXPECT_NEAR(cascade_gain_db(lp, 2000.0), -6.0206, 1e-3);
+        EXPECT_NEAR(cascade_gain_db(hp, 2000.0), -6.0206, 1e-3);
+
+        const double polarity = (order / 2) % 2 == 1 ? -1.0 : 1.0;
+        for (double freq : {50.0, 500.0, 2000.0, 5000.0, 15000.0})
+        {
+            double sum = std::abs(cascade_response(lp, freq) + polarity * cascade_response(hp, freq));
+            EXPECT_NEAR(sum, 1.0, 1e-9) << "LR" << order << " at " << freq;
+        }
+    }
+
+    EXPECT_THROW(CascadeDesign::linkwitz_riley_lowpass(SAMPLE_RATE, 1000.0, 3), std::invalid_argument);
+}
+
+TEST_F(FilterTest, ChebyshevRippleAndStopband)
+{
+    for (int order : {3, 4})
+    {
+        auto cheby1 = CascadeDesign::chebyshev1_lowpass(SAMPLE_RATE, 1000.0, order, 1.0);
+        EXPECT_NEAR(cascade_gain_db(cheby1, 1000.0), -1.0, 1e-3);
+        for (double freq = 10.0; freq < 1000.0; freq += 10.0)
+        {
+            double gain = cascade_gain_db(cheby1, freq);
+            ASSERT_LE(gain, 1e-9);
+            ASSERT_GE(gain, -1.0 - 1e-9);
+        }
+
+        auto cheby2 = CascadeDesign::chebyshev2_lowpass(SAMPLE_RATE, 1000.0, order, 40.0);
+        EXPECT_NEAR(cascade_gain_db(cheby2, 10.0), 0.0, 1e-3);
+        EXPECT_NEAR(cascade_gain_db(cheby2, 1000.0), -40.0, 1e-3);
+        for (double freq = 1000.0; freq < 22000.0; freq += 50.0)
+        {
+            ASSERT_LE(cascade_gain_db(cheby2, freq), -40.0 + 1e-6);
+        }
+
+        auto cheby2_hp = CascadeDesign::chebyshev2_highpass(SAMPLE_RATE, 1000.0, order, 40.0);
+        EXPECT_NEAR(cascade_gain_db(cheby2_hp, 20000.0), 0.0, 1e-2);
+        EXPECT_LE(cascade_gain_db(cheby2_hp, 500.0), -40.0 + 1e-6);
+    }
+}
+
+TEST_F(FilterTest, CascadeFilterEffectMatchesSections)
+{
+    auto sections = CascadeDesign::butterworth_lowpass(SAMPLE_RATE, 500.0, 8);
+    CascadeFilterEffect<float> effect(sections);
+    EXPECT_EQ(effect.num_sections(), 4u);
+
+    // 0.2 s holds whole cycles, so the second block continues the first
+    auto warmup = generate_sine(4000.0, 0.2);
+    auto signal = generate_sine(4000.0, 0.2);
+    effect.process(warmup);
+    effect.process(signal);
+    EXPECT_LT(calculate_rms(signal), 1e-4f);
+}
+
+// FFT and FIR tests
+TEST_F(FilterTest, FFTMatchesNaiveDFT)
+{
+    const size_t N = 64;
+    FFT<double> fft(N);
+
+    std::vector<double> x(N);
+    for (size_t n = 0; n < N; ++n)
+    {
+        x[n] = std::sin(0.37 * n) + 0.25 * std::cos(1.9 * n * n);
+    }
+
+    std::vector<std::complex<double>> bins(fft.num_bins());
+    fft.forward_real(x.data(), bins.data());
+
+    std::vector<std::complex<double>> full(x.begin(), x.end());
+    fft.forward(full.data());
+
+    for (size_t k = 0; k < N; ++k)
+    {
+        std::complex<double> expected = 0.0;
+        for (size_t n = 0; n < N; ++n)
+        {
+            expected += x[n] * std::polar(1.0, -TWO_PI * static_cast<double>((k * n) % N) / N);
+        }
+        ASSERT_NEAR(std::abs(full[k] - expected), 0.0, 1e-10);
+        if (k < fft.num_bins())
+        {
+            ASSERT_NEAR(std::abs(bins[k] - expected), 0.0, 1e-10);
+        }
+    }
+
+    std::vector<double> back(N);
+    fft.inverse_real(bins.data(), back.data());
+    fft.inverse(full.data());
+    for (size_t n = 0; n < N; ++n)
+    {
+        ASSERT_NEAR(back[n], x[n], 1e-12);
+        ASSERT_NEAR(full[n].real(), x[n], 1e-12);
+    }
+
+    EXPECT_THROW(FFT<float>(0), std::invalid_argument);
+}
+
+TEST_F(FilterTest, FFTMixedRadixSizes)
+{
+    // Radix 2/4 only, 3 and 5, a generic prime (7), and odd sizes
+    for (size_t N : {8u, 12u, 48u, 60u, 100u, 105u, 98u, 243u, 1000u})
+    {
+        FFT<double> fft(N);
+
+        std::vector<std::complex<double>> x(N);
+        for (size_t n = 0; n < N; ++n)
+        {
+            x[n] = {std::sin(0.37 * n), std::cos(1.3 * n)};
+        }
+        auto spectrum = x;
+        fft.forward(spectrum.data());
+
+        for (size_t k = 0; k < N; k += 7)
+        {
+            std::complex<double> expected = 0.0;
+            for (size_t n = 0; n < N; ++n)
+            {
+                expected += x[n] * std::polar(1.0, -TWO_PI * static_cast<double>((k * n) % N) / N);
+            }
+            ASSERT_NEAR(std::abs(spectrum[k] - expected), 0.0, 1e-10) << "N=" << N << " k=" << k;
+        }
+
+        fft.inverse(spectrum.data());
+        for (size_t n = 0; n < N; ++n)
+        {
+            ASSERT_NEAR(std::abs(spectrum[n] - x[n]), 0.0, 1e-12);
+        }
+
+        if (N % 2 == 0)
+        {
+            std::vector<double> real(N);
+            for (size_t n = 0; n < N; ++n)
+            {
+                real[n] = x[n].real();
+            }
+            std::vector<std::complex<double>> bins(fft.num_bins());
+            fft.forward_real(real.data(), bins.data());
+            std::vector<double> back(N);
+            fft.inverse_real(bins.data(), back.data());
+            for (size_t n = 0; n < N; ++n)
+            {
+                ASSERT_NEAR(back[n], real[n], 1e-12);
+            }
+        }
+    }
+
+    std::vector<std::complex<float>> bins(8);
+    std::vector<float> odd(15);
+    EXPECT_THROW(FFT<float>(15).forward_real(odd.data(), bins.data()), std::logic_error);
+    EXPECT_THROW(FFT<float>(2 * 67), std::invalid_argument);
+}
+
+TEST_F(FilterTest, FFTPlanCacheSharesPlans)
+{
+    auto a = FFT<float>::plan(480);
+    auto b = FFT<float>::plan(480);
+    EXPECT_EQ(a.get(), b.get());
+    EXPECT_NE(FFT<double>::plan(480).get(), nullptr);
+
+    // Concurrent first use of a new size yields one shared plan
+    ThreadPool pool(4);
+    std::vector<std::shared_ptr<const FFT<float>>> plans(16);
+    pool.parallel_for(plans.size(), [&](size_t i)
+                      { plans[i] = FFT<float>::plan(3000); });
+    for (const auto &plan : plans)
+    {
+        EXPECT_EQ(plan.get(), plans[0].get());
+    }
+
+    // The complex plan of a cached size is built once, on concurrent first use
+    std::vector<std::complex<float>> expected(3000);
+    for (size_t n = 0; n < expected.size(); ++n)
+    {
+        expected[n] = {std::sin(0.01f * static_cast<float>(n)), 0.0f};
+    }
+    std::vector<std::vector<std::complex<float>>> spectra(8, expected);
+    pool.parallel_for(spectra.size(), [&](size_t i)
+                      { plans[0]->forward(spectra[i].data()); });
+    FFT<float>(3000).forward(expected.data());
+    for (const auto &spectrum : spectra)
+    {
+        EXPECT_EQ(spectrum, expected);
+    }
+}
+
+namespace
+{
+    std::vector<double> direct_convolution(const std::vector<double> &x, const std::vector<double> &h)
+    {
+        std::vector<double> y(x.size(), 0.0);
+        for (size_t n = 0; n < x.size(); ++n)
+        {
+            for (size_t k = 0; k < h.size() && k <= n; ++k)
+            {
+                y[n] += h[k] * x[n - k];
+            }
+        }
+        return y;
+    }
+}
+
+TEST_F(FilterTest, FIRMatchesDirectConvolution)
+{
+    // Direct-only and partitioned sizes, fed in awkward block lengths
+    for (size_t taps : {1u, 31u, 128u, 129u, 1000u, 5000u})
+    {
+        std::vector<double> h(taps);
+        for (size_t k = 0; k < taps; ++k)
+        {
+            h[k] = std::exp(-0.002 * k) * std::sin(0.3 * k + 1.0);
+        }
+
+        std::vector<double> x(12000);
+        for (size_t n = 0; n < x.size(); ++n)
+        {
+            x[n] = std::sin(0.01 * n) + 0.5 * std::sin(0.77 * n);
+        }
+        auto expected = direct_convolution(x, h);
+
+        // Stereo: channel 1 carries the negated signal
+        FIRFilter<double> fir(h);
+        EXPECT_EQ(fir.is_partitioned(), taps > FIRFilter<double>::direct_max_taps);
+
+        std::vector<double> stereo(2 * x.size());
+        for (size_t n = 0; n < x.size(); ++n)
+        {
+            stereo[2 * n] = x[n];
+            stereo[2 * n + 1] = -x[n];
+        }
+
+        size_t pos = 0;
+        for (size_t block : {1u, 7u, 300u, 64u, 1023u})
+        {
+            for (; pos + block <= x.size() && pos < x.size() / 2 + block * 3; pos += block)
+            {
+                fir.process_buffer(stereo.data() + 2 * pos, block, 2);
+            }
+        }
+        fir.process_buffer(stereo.data() + 2 * pos, x.size() - pos, 2);
+
+        for (size_t n = 0; n < x.size(); ++n)
+        {
+            ASSERT_NEAR(stereo[2 * n], expected[n], 1e-9) << taps << " taps, sample " << n;
+            ASSERT_NEAR(stereo[2 * n + 1], -expected[n], 1e-9);
+        }
+    }
+}
+
+TEST_F(FilterTest, FIRDesignLinearPhaseLowpass)
+{
+    auto taps = FIRDesign::lowpass(SAMPLE_RATE, 2000.0, 255);
+    ASSERT_EQ(taps.size(), 255u);
+    for (size_t n = 0; n < taps.size(); ++n)
+    {
+        ASSERT_NEAR(taps[n], taps[taps.size() - 1 - n], 1e-15);
+    }
+
+    FIRFilterEffect<float> lowpass(taps);
+    auto low = generate_sine(200.0, 0.2);
+    auto high = generate_sine(8000.0, 0.2);
+    float low_rms = calculate_rms(low);
+    lowpass.process(low);
+    lowpass.reset();
+    lowpass.process(high);
+
+    EXPECT_NEAR(calculate_rms(low), low_rms, 0.02f);
+
+    // Stopband once the filter has filled (skip the onset transient)
+    double energy = 0.0;
+    for (size_t i = taps.size(); i < high.num_samples(); ++i)
+    {
+        energy += high.data()[i] * high.data()[i];
+    }
+    EXPECT_LT(std::sqrt(energy / (high.num_samples() - taps.size())), 1e-3);
+
+    auto hp = FIRDesign::highpass(SAMPLE_RATE, 2000.0, 255);
+    EXPECT_NEAR(std::accumulate(hp.begin(), hp.end(), 0.0), 0.0, 1e-12);
+    EXPECT_THROW(FIRDesign::highpass(SAMPLE_RATE, 2000.0, 256), std::invalid_argument);
+}
+
+TEST_F(FilterTest, ZeroPhaseImpulseIsSymmetric)
+{
+    ThreadPool pool(2);
+    ZeroPhaseFilter<double> filter(CascadeDesign::butterworth_lowpass(SAMPLE_RATE, 2000.0, 4), pool);
+
+    // Impulse well away from the edges: forward-backward response is even
+    std::vector<double> signal(4001, 0.0);
+    signal[2000] = 1.0;
+    filter.process_buffer(signal.data(), signal.size(), 1);
+
+    size_t peak = std::max_element(signal.begin(), signal.end()) - signal.begin();
+    EXPECT_EQ(peak, 2000u);
+    for (size_t k = 1; k < 500; ++k)
+    {
+        ASSERT_NEAR(signal[2000 + k], signal[2000 - k], 1e-12);
+    }
+
+    // Squared magnitude: the sum of the response is the DC gain, 1
+    EXPECT_NEAR(std::accumulate(signal.begin(), signal.end(), 0.0), 1.0, 1e-9);
+}
+
+TEST_F(FilterTest, ZeroPhaseKeepsPassbandInPlace)
+{
+    ThreadPool pool(2);
+    BiquadCascade<float> cascade(CascadeDesign::butterworth_lowpass(SAMPLE_RATE, 5000.0, 2));
+    ZeroPhaseFilter<float> filter(cascade, pool);
+
+    // Stereo, each channel carrying a different phase of the same tone
+    const size_t n = 8192;
+    AudioBuffer<float> buffer(n, 2);
+    AudioBuffer<float> reference(n, 2);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double t = static_cast<double>(i) / SAMPLE_RATE;
+        buffer(i, 0) = reference(i, 0) = static_cast<float>(std::sin(2.0 * PI * 500.0 * t));
+        buffer(i, 1) = reference(i, 1) = static_cast<float>(std::cos(2.0 * PI * 500.0 * t));
+    }
+
+    EXPECT_EQ(filter.padding(), 9u);
+    filter.process_buffer(buffer.data(), n, 2);
+
+    // No lag: output is the input scaled by |H|^2; padding and initial
+    // state keep the edges close too
+    const float gain = static_cast<float>(std::norm(cascade_response(filter.sections(), 500.0)));
+    for (size_t i = 0; i < n; ++i)
+    {
+        const bool edge = i < 64 || i >= n - 64;
+        const float tolerance = edge ? 1e-2f : 1e-4f;
+        ASSERT_NEAR(buffer(i, 0), reference(i, 0) * gain, tolerance) << "frame " << i;
+        ASSERT_NEAR(buffer(i, 1), reference(i, 1) * gain, tolerance) << "frame " << i;
+    }
+}
+
+TEST_F(FilterTest, ZeroPhaseHoldsConstantSignal)
+{
+    ZeroPhaseFilter<int16_t> filter(FilterDesign::lowpass(SAMPLE_RATE, 100.0, 0.707));
+
+    std::vector<int16_t> signal(1000, 12000);
+    filter.process_buffer(signal.data(), signal.size(), 1);
+    for (int16_t sample : signal)
+    {
+        ASSERT_NEAR(sample, 12000, 1);
+    }
+
+    // Very short signals shrink the padding instead of failing
+    std::vector<int16_t> tiny{100, 200};
+    EXPECT_NO_THROW(filter.process_buffer(tiny.data(), tiny.size(), 1));
+}
+
+TEST_F(FilterTest, FrequencyResponseMatchesDirectEvaluation)
+{
+    auto sections = CascadeDesign::chebyshev1_lowpass(SAMPLE_RATE, 3000.0, 7, 0.5);
+    sections.push_back(FilterDesign::peaking_eq(SAMPLE_RATE, 800.0, 2.0, 6.0));
+
+    std::vector<double> freqs;
+    for (double f = 10.0; f < 22000.0; f *= 1.05)
+    {
+        freqs.push_back(f);
+    }
+
+    auto response = frequency_response(sections, SAMPLE_RATE, freqs);
+    ASSERT_EQ(response.size(), freqs.size());
+    for (size_t i = 0; i < freqs.size(); ++i)
+    {
+        const std::complex<double> expected = cascade_response(sections, freqs[i]);
+        ASSERT_NEAR(response.magnitude[i], std::abs(expected), 1e-9 * std::max(1.0, std::abs(expected)));
+        if (std::abs(expected) > 1e-6)
+        {
+            ASSERT_NEAR(std::remainder(response.phase[i] - std::arg(expected), TWO_PI), 0.0, 1e-9);
+        }
+    }
+
+    // Single biquad and cascade overloads agree with the section list
+    auto single = frequency_response(sections.back(), SAMPLE_RATE, freqs);
+    EXPECT_NEAR(single.magnitude_db(0), cascade_gain_db({sections.back()}, freqs[0]), 1e-9);
+
+    BiquadCascade<float> cascade(sections);
+    cascade.set_section_enabled(sections.size() - 1, false);
+    sections.pop_back();
+    auto partial = frequency_response(cascade, SAMPLE_RATE, freqs);
+    EXPECT_NEAR(partial.magnitude[20], std::abs(cascade_response(sections, freqs[20])), 1e-12);
+}
+
+TEST_F(FilterTest, EqualizerFrequencyResponse)
+{
+    Equalizer<float> eq(SAMPLE_RATE);
+    eq.add_band(100.0, 6.0, 1.0);
+    eq.add_band(5000.0, -4.0, 1.0);
+
+    const std::vector<double> freqs{100.0, 5000.0, 20.0};
+    FrequencyGrid grid(SAMPLE_RATE, freqs);
+    FrequencyResponse response;
+    eq.frequency_response(grid, response);
+
+    // Bands are far apart, so each centre is close to its own gain
+    EXPECT_NEAR(response.magnitude_db(0), 6.0, 0.1);
+    EXPECT_NEAR(response.magnitude_db(1), -4.0, 0.1);
+
+    eq.set_band_enabled(0, false);
+    EXPECT_NEAR(eq.frequency_response(freqs).magnitude_db(0), 0.0, 0.1);
+
+    ThreeBandEQ<float> tone(SAMPLE_RATE);
+    tone.set_bass(8.0);
+    tone.set_treble(-5.0);
+    auto curve = tone.frequency_response(std::vector<double>{20.0, 20000.0});
+    EXPECT_NEAR(curve.magnitude_db(0), 8.0, 0.2);
+    EXPECT_NEAR(curve.magnitude_db(1), -5.0, 0.2);
+}
+
+namespace
+{
+    // Resample a whole signal, feeding it in blocks of block_frames
+    template <typename SampleType>
+    std::vector<SampleType> resample_all(Resampler<SampleType> &resampler, const std::vector<SampleType> &input,
+                                         size_t block_frames)
+    {
+        const size_t channels = resampler.num_channels();
+        const size_t frames = input.size() / channels;
+        std::vector<SampleType> output;
+        std::vector<SampleType> block;
+
+        for (size_t start = 0; start < frames; start += block_frames)
+        {
+            const size_t count = std::min(block_frames, frames - start);
+            block.resize(resampler.max_output_frames(count) * channels);
+            const size_t written = resampler.process(input.data() + start * channels, count, block.data(), block.size() / channels);
+            output.insert(output.end(), block.begin(), block.begin() + written * channels);
+        }
+
+        block.resize(resampler.max_output_frames(resampler.latency()) * channels);
+        const size_t written = resampler.flush(block.data(), block.size() / channels);
+        output.insert(output.end(), block.begin(), block.begin() + written * channels);
+        return output;
+    }
+}
+
+TEST_F(FilterTest, ResamplerRationalMatchesIdealSine)
+{
+    Resampler<float> resampler(44100.0, 48000.0, 2);
+    ASSERT_TRUE(resampler.is_rational());
+    EXPECT_EQ(resampler.num_phases(), 160u);
+
+    // Stereo: 1 kHz sine left, 3 kHz cosine right
+    const size_t frames = 44100 / 4;
+    std::vector<float> input(frames * 2);
+    for (size_t i = 0; i < frames; ++i)
+    {
+        const double t = static_cast<double>(i) / 44100.0;
+        input[2 * i] = static_cast<float>(0.5 * std::sin(TWO_PI * 1000.0 * t));
+        input[2 * i + 1] = static_cast<float>(0.5 * std::cos(TWO_PI * 3000.0 * t));
+    }
+
+    auto output = resample_all(resampler, input, 1000);
+    EXPECT_EQ(output.size() / 2, 12000u);
+
+    // Time-aligned with the input: compare away from the edges
+    for (size_t k = 200; k < 11800; ++k)
+    {
+        const double t = static_cast<double>(k) / 48000.0;
+        ASSERT_NEAR(output[2 * k], 0.5 * std::sin(TWO_PI * 1000.0 * t), 2e-4) << "frame " << k;
+        ASSERT_NEAR(output[2 * k + 1], 0.5 * std::cos(TWO_PI * 3000.0 * t), 2e-4) << "frame " << k;
+    }
+}
+
+TEST_F(FilterTest, ResamplerBlockSizeIndependent)
+{
+    std::vector<double> input(20000);
+    uint32_t seed = 99;
+    for (auto &x : input)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        x = static_cast<double>(seed) / 4294967296.0 - 0.5;
+    }
+
+    Resampler<double> whole(48000.0, 44100.0, 1);
+    Resampler<double> blocks(48000.0, 44100.0, 1);
+    auto reference = resample_all(whole, input, input.size());
+    auto chunked = resample_all(blocks, input, 37);
+
+    ASSERT_EQ(reference.size(), chunked.size());
+    for (size_t i = 0; i < reference.size(); ++i)
+    {
+        ASSERT_EQ(reference[i], chunked[i]) << "frame " << i;
+    }
+
+    // Small output capacity keeps the rest pending instead of dropping it
+    Resampler<double> limited(48000.0, 44100.0, 1);
+    std::vector<double> out(reference.size() + 8);
+    size_t written = limited.process(input.data(), input.size(), out.data(), 100);
+    EXPECT_EQ(written, 100u);
+    written += limited.process(nullptr, 0, out.data() + written, out.size() - written);
+    written += limited.flush(out.data() + written, out.size() - written);
+    ASSERT_EQ(written, reference.size());
+    EXPECT_EQ(out[150], reference[150]);
+}
+
+TEST_F(FilterTest, ResamplerDownsamplingRejectsAliases)
+{
+    Resampler<float> resampler(48000.0, 16000.0, 1, ResamplerQuality::High);
+    EXPECT_EQ(resampler.num_phases(), 1u);
+    EXPECT_GT(resampler.taps_per_phase(), 96u * 2);
+
+    // 11 kHz is above the 8 kHz output Nyquist and would fold to 5 kHz
+    std::vector<float> input(48000 / 2);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<float>(std::sin(TWO_PI * 11000.0 * static_cast<double>(i) / 48000.0));
+    }
+    auto output = resample_all(resampler, input, 512);
+
+    double energy = 0.0;
+    for (size_t k = 500; k < output.size() - 500; ++k)
+    {
+        energy += output[k] * output[k];
+    }
+    const double rms = std::sqrt(energy / static_cast<double>(output.size() - 1000));
+    EXPECT_LT(20.0 * std::log10(rms), -90.0);
+}
+
+TEST_F(FilterTest, ResamplerVariableRatio)
+{
+    // Non-integer rate: interpolated phases from the start
+    Resampler<float> drift(44100.0, 44100.5, 1);
+    EXPECT_FALSE(drift.is_rational());
+
+    Resampler<float> resampler(48000.0, 48000.0, 1, ResamplerQuality::Draft);
+    EXPECT_TRUE(resampler.is_rational());
+    resampler.set_ratio(1.01);
+    EXPECT_FALSE(resampler.is_rational());
+    EXPECT_EQ(resampler.num_phases(), 128u);
+
+    std::vector<float> input(48000);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<float>(std::sin(TWO_PI * 500.0 * static_cast<double>(i) / 48000.0));
+    }
+    auto output = resample_all(resampler, input, 480);
+    EXPECT_NEAR(static_cast<double>(output.size()), 48000.0 * 1.01, 2.0);
+
+    // Still a clean 500 Hz tone at the stretched time base
+    for (size_t k = 100; k < output.size() - 100; ++k)
+    {
+        const double t = static_cast<double>(k) / (48000.0 * 1.01);
+        ASSERT_NEAR(output[k], std::sin(TWO_PI * 500.0 * t), 2e-3) << "frame " << k;
+    }
+
+    EXPECT_THROW(resampler.set_ratio(0.0), std::invalid_argument);
+    EXPECT_THROW(Resampler<float>(0.0, 48000.0, 1), std::invalid_argument);
+    EXPECT_THROW(Resampler<float>(44100.0, 48000.0, 0), std::invalid_argument);
+}
+
+namespace
+{
+    // Memoryless nonlinearity for the oversampling tests
+    class HardClipEffect : public AudioEffect<float>
+    {
+    public:
+        explicit HardClipEffect(float threshold) : threshold_(threshold) {}
+
+        void process(AudioBuffer<float> &buffer) override
+        {
+            for (size_t i = 0; i < buffer.total_samples(); ++i)
+            {
+                buffer.data()[i] = std::clamp(buffer.data()[i], -threshold_, threshold_);
+            }
+        }
+
+        void reset() override {}
+
+    private:
+        float threshold_;
+    };
+
+    // Amplitude of the component at freq (single-bin DFT over the range)
+    double tone_amplitude(const AudioBuffer<float> &buffer, double freq, size_t first, size_t count)
+    {
+        std::complex<double> sum = 0.0;
+        for (size_t i = first; i < first + count; ++i)
+        {
+            sum += static_cast<double>(buffer.data()[i]) * std::polar(1.0, -TWO_PI * freq * static_cast<double>(i) / 44100.0);
+        }
+        return 2.0 * std::abs(sum) / static_cast<double>(count);
+    }
+}
+
+TEST_F(FilterTest, OversampledIdentityIsDelayedInput)
+{
+    Oversampled<GainEffect<float>> wrapped(2, 1.0f);
+    EXPECT_EQ(wrapped.factor(), 2u);
+    EXPECT_DOUBLE_EQ(wrapped.latency(), 23.0);
+
+    auto buffer = generate_sine(1000.0, 0.1, 2);
+    auto original = buffer;
+    wrapped.process(buffer);
+
+    const size_t delay = 23;
+    for (size_t i = delay + 100; i < buffer.num_samples(); ++i)
+    {
+        ASSERT_NEAR(buffer(i, 0), original(i - delay, 0), 1e-3f) << "frame " << i;
+        ASSERT_NEAR(buffer(i, 1), original(i - delay, 1), 1e-3f) << "frame " << i;
+    }
+
+    EXPECT_DOUBLE_EQ(Oversampled<GainEffect<float>>(4).latency(), 23.0 + 22.0 / 4.0);
+    EXPECT_DOUBLE_EQ(Oversampled<GainEffect<float>>(1).latency(), 0.0);
+    EXPECT_THROW(Oversampled<GainEffect<float>>(3), std::invalid_argument);
+}
+
+TEST_F(FilterTest, OversampledClipperReducesAliasing)
+{
+    // 5th harmonic of 7 kHz (35 kHz) folds to 9.1 kHz at 1x
+    const double alias_freq = 44100.0 - 5.0 * 7000.0;
+
+    auto plain_buffer = generate_sine(7000.0, 0.2);
+    auto over_buffer = plain_buffer;
+
+    HardClipEffect plain(0.3f);
+    Oversampled<HardClipEffect> oversampled(8, 0.3f);
+    plain.process(plain_buffer);
+
+    // Several blocks to exercise the streaming state
+    const size_t block = 1024;
+    for (size_t start = 0; start + block <= over_buffer.num_samples(); start += block)
+    {
+        AudioBuffer<float> part(block, 1);
+        std::copy(over_buffer.data() + start, over_buffer.data() + start + block, part.data());
+        oversampled.process(part);
+        std::copy(part.data(), part.data() + block, over_buffer.data() + start);
+    }
+
+    const size_t first = 1024, count = 4096;
+    const double plain_alias = tone_amplitude(plain_buffer, alias_freq, first, count);
+    const double over_alias = tone_amplitude(over_buffer, alias_freq, first, count);
+
+    EXPECT_GT(plain_alias, 1e-2);
+    EXPECT_LT(over_alias, plain_alias / 30.0);
+
+    // The wanted harmonic survives
+    EXPECT_NEAR(tone_amplitude(over_buffer, 7000.0, first, count), tone_amplitude(plain_buffer, 7000.0, first, count), 0.02);
+}
+
+TEST_F(FilterTest, StateVariableMatchesBiquadDesigns)
+{
+    // TPT responses equal the bilinear (cookbook) biquads sample for sample
+    struct Case
+    {
+        SVFMode mode;
+        double q;
+        double gain_db;
+        BiquadCoefficients coeffs;
+    };
+
+    // Cookbook shelves with slope 1 have Q = 1/sqrt(2); the peaking EQ's
+    // bandwidth in octaves maps to an analog Q through its prewarp
+    const double shelf_q = 1.0 / std::sqrt(2.0);
+    const double omega = TWO_PI * 1000.0 / SAMPLE_RATE;
+    const double bell_q = 1.0 / (2.0 * std::sinh(LN2 / 2.0 * 1.0 * omega / std::sin(omega)));
+
+    std::vector<Case> cases = {
+        {SVFMode::Lowpass, 2.0, 0.0, FilterDesign::lowpass(SAMPLE_RATE, 1200.0, 2.0)},
+        {SVFMode::Highpass, 2.0, 0.0, FilterDesign::highpass(SAMPLE_RATE, 1200.0, 2.0)},
+        {SVFMode::Allpass, 2.0, 0.0, FilterDesign::allpass(SAMPLE_RATE, 1200.0, 2.0)},
+    };
+    for (double gain_db : {6.0, -6.0, 12.0, -12.0})
+    {
+        cases.push_back({SVFMode::LowShelf, shelf_q, gain_db, FilterDesign::low_shelf(SAMPLE_RATE, 1000.0, gain_db)});
+        cases.push_back({SVFMode::HighShelf, shelf_q, gain_db, FilterDesign::high_shelf(SAMPLE_RATE, 1000.0, gain_db)});
+        cases.push_back({SVFMode::Bell, bell_q, gain_db, FilterDesign::peaking_eq(SAMPLE_RATE, 1000.0, gain_db, 1.0)});
+    }
+
+    for (const auto &test : cases)
+    {
+        const double cutoff = test.mode <= SVFMode::Allpass ? 1200.0 : 1000.0;
+        StateVariableFilter<double> svf(SAMPLE_RATE, cutoff, test.q, test.mode);
+        svf.set_gain_db(test.gain_db);
+        BiquadFilter<double> biquad(test.coeffs);
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            const double x = i == 0 ? 1.0 : std::sin(0.05 * static_cast<double>(i));
+            ASSERT_NEAR(svf.process_sample(x), biquad.process_sample(x), 1e-9)
+                << "mode " << static_cast<int>(test.mode) << " gain " << test.gain_db << " sample " << i;
+        }
+    }
+
+    // Equal boost and cut mirror each other across the whole curve
+    const double tones[] = {100.0, 300.0, 700.0, 1400.0, 3000.0, 10000.0};
+    for (SVFMode mode : {SVFMode::LowShelf, SVFMode::HighShelf, SVFMode::Bell})
+    {
+        StateVariableFilter<double> boost(SAMPLE_RATE, 1000.0, shelf_q, mode), cut(SAMPLE_RATE, 1000.0, shelf_q, mode);
+        boost.set_gain_db(6.0);
+        cut.set_gain_db(-6.0);
+        for (double freq : tones)
+        {
+            double in = 0.0, up = 0.0, down = 0.0;
+            for (size_t i = 0; i < 44100; ++i)
+            {
+                const double x = std::sin(TWO_PI * freq * static_cast<double>(i) / SAMPLE_RATE);
+                const double a = boost.process_sample(x), b = cut.process_sample(x);
+                if (i > 22050)
+                {
+                    in += x * x;
+                    up += a * a;
+                    down += b * b;
+                }
+            }
+            EXPECT_NEAR(10.0 * std::log10(up / in), -10.0 * std::log10(down / in), 0.02)
+                << "mode " << static_cast<int>(mode) << " at " << freq << " Hz";
+        }
+    }
+}
+
+TEST_F(FilterTest, StateVariableOutputsAreConsistent)
+{
+    StateVariableFilter<float> svf(SAMPLE_RATE, 2000.0, 1.5);
+    svf.set_gain_db(6.0);
+
+    // Bandpass is unity at the centre frequency
+    double band_energy = 0.0, input_energy = 0.0;
+    for (size_t i = 0; i < 44100; ++i)
+    {
+        const float x = static_cast<float>(std::sin(TWO_PI * 2000.0 * static_cast<double>(i) / SAMPLE_RATE));
+        const auto y = svf.process_all(x);
+
+        ASSERT_NEAR(y.notch, y.lowpass + y.highpass, 1e-5f);
+        ASSERT_NEAR(y.peak, y.lowpass - y.highpass, 1e-5f);
+        if (i > 4410)
+        {
+            band_energy += y.bandpass * y.bandpass;
+            input_energy += x * x;
+        }
+    }
+    EXPECT_NEAR(band_energy / input_energy, 1.0, 1e-3);
+
+    // Shelves and bell reach the set gain where they should
+    auto gain_at = [&](SVFMode mode, double freq)
+    {
+        StateVariableFilter<double> filter(SAMPLE_RATE, 2000.0, 0.707, mode);
+        filter.set_gain_db(6.0);
+        double in = 0.0, out = 0.0;
+        for (size_t i = 0; i < 44100; ++i)
+        {
+            const double x = std::sin(TWO_PI * freq * static_cast<double>(i) / SAMPLE_RATE);
+            const double y = filter.process_sample(x);
+            if (i > 22050)
+            {
+                in += x * x;
+                out += y * y;
+            }
+        }
+        return 10.0 * std::log10(out / in);
+    };
+    EXPECT_NEAR(gain_at(SVFMode::LowShelf, 30.0), 6.0, 0.05);
+    EXPECT_NEAR(gain_at(SVFMode::HighShelf, 18000.0), 6.0, 0.3);
+    EXPECT_NEAR(gain_at(SVFMode::Bell, 2000.0), 6.0, 0.05);
+    EXPECT_NEAR(gain_at(SVFMode::Bell, 30.0), 0.0, 0.05);
+}
+
+TEST_F(FilterTest, StateVariableBufferMatchesPerSample)
+{
+    const size_t frames = 512;
+    const size_t channels = 3;
+    std::vector<float> buffer(frames * channels);
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+        buffer[i] = static_cast<float>(std::sin(0.013 * static_cast<double>(i)));
+    }
+    auto reference = buffer;
+
+    // Exponential sweep, one cutoff per frame
+    std::vector<double> cutoffs(frames);
+    for (size_t i = 0; i < frames; ++i)
+    {
+        cutoffs[i] = 100.0 * std::pow(150.0, static_cast<double>(i) / frames);
+    }
+
+    StateVariableFilter<float> block(SAMPLE_RATE, 100.0, 4.0, SVFMode::Bandpass);
+    block.process_buffer(buffer.data(), frames, channels, cutoffs.data());
+    EXPECT_DOUBLE_EQ(block.cutoff(), cutoffs.back());
+
+    StateVariableFilter<float> single(SAMPLE_RATE, 100.0, 4.0, SVFMode::Bandpass);
+    for (size_t i = 0; i < frames; ++i)
+    {
+        single.set_cutoff(cutoffs[i]);
+        for (size_t ch = 0; ch < channels; ++ch)
+        {
+            const float expected = single.process_sample(reference[i * channels + ch], ch);
+            ASSERT_NEAR(buffer[i * channels + ch], expected, 1e-6f) << "frame " << i;
+            ASSERT_LT(std::abs(buffer[i * channels + ch]), 4.0f);
+        }
+    }
+}
+
+namespace
+{
+    // Designed entirely at compile time
+    constexpr BiquadCoefficients fixed_lowpass = FilterDesign::lowpass(44100.0, 1000.0, 0.707);
+    constexpr BiquadCoefficients fixed_shelf = FilterDesign::high_shelf(44100.0, 4000.0, 4.0, 1.0);
+    constexpr BiquadCoefficients fixed_bell = FilterDesign::peaking_eq(44100.0, 300.0, -6.0, 1.0);
+    static_assert(fixed_lowpass.a0 == 1.0 && fixed_lowpass.b0 > 0.0);
+
+    // First-order DC blocker: 1 - z^-1 over 1 - 0.995 z^-1
+    constexpr BiquadCoefficients dc_blocker{1.0, -1.0, 0.0, 1.0, -0.995, 0.0};
+}
+
+TEST_F(FilterTest, ConstexprDesignMatchesRuntime)
+{
+    const BiquadCoefficients pairs[][2] = {
+        {fixed_lowpass, FilterDesign::lowpass(SAMPLE_RATE, 1000.0, 0.707)},
+        {fixed_shelf, FilterDesign::high_shelf(SAMPLE_RATE, 4000.0, 4.0, 1.0)},
+        {fixed_bell, FilterDesign::peaking_eq(SAMPLE_RATE, 300.0, -6.0, 1.0)},
+    };
+
+    for (const auto &pair : pairs)
+    {
+        EXPECT_NEAR(pair[0].b0, pair[1].b0, 1e-9);
+        EXPECT_NEAR(pair[0].b1, pair[1].b1, 1e-9);
+        EXPECT_NEAR(pair[0].b2, pair[1].b2, 1e-9);
+        EXPECT_NEAR(pair[0].a1, pair[1].a1, 1e-9);
+        EXPECT_NEAR(pair[0].a2, pair[1].a2, 1e-9);
+    }
+}
+
+TEST_F(FilterTest, FixedBiquadMatchesBiquadFilter)
+{
+    FixedBiquad<fixed_bell, float> fixed;
+    BiquadFilter<float> dynamic(fixed_bell);
+
+    auto a = generate_sine(300.0, 0.05, 2);
+    auto b = a;
+    fixed.process_buffer(a.data(), a.num_samples(), 2);
+    dynamic.process_buffer(b.data(), b.num_samples(), 2);
+    for (size_t i = 0; i < a.total_samples(); ++i)
+    {
+        ASSERT_FLOAT_EQ(a.data()[i], b.data()[i]);
+    }
+
+    // Zero terms are folded away; the first-order blocker still removes DC
+    FixedBiquad<dc_blocker, double> blocker;
+    double y = 0.0;
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        y = blocker.process_sample(1.0 + std::sin(0.3 * static_cast<double>(i)));
+    }
+    EXPECT_LT(std::abs(y - std::sin(0.3 * 4999.0)), 0.02);
+    using Blocker = FixedBiquad<dc_blocker, double>;
+    EXPECT_EQ(Blocker::coefficients.a2, 0.0);
+}
+
+namespace
+{
+    // Run a fixed-point filter and a double reference over the same integer signal
+    template <typename SampleType>
+    std::pair<double, double> fixed_point_error(const BiquadCoefficients &coeffs, const std::vector<SampleType> &input, size_t channels)
+    {
+        FixedPointBiquad<SampleType> fixed(coeffs);
+        BiquadFilter<double> reference(coeffs);
+
+        std::vector<SampleType> out = input;
+        std::vector<double> ref(input.begin(), input.end());
+        fixed.process_buffer(out.data(), out.size() / channels, channels);
+        reference.process_buffer(ref.data(), ref.size() / channels, channels);
+
+        double max_error = 0.0, sum_squares = 0.0;
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            const double error = static_cast<double>(out[i]) - ref[i];
+            max_error = std::max(max_error, std::abs(error));
+            sum_squares += error * error;
+        }
+        return {max_error, std::sqrt(sum_squares / static_cast<double>(out.size()))};
+    }
+}
+
+TEST_F(FilterTest, FixedPointBiquadTracksDoubleReference)
+{
+    const size_t channels = 3;
+    const size_t frames = 8192;
+
+    std::vector<int16_t> pcm16(frames * channels);
+    std::vector<int32_t> pcm24(frames * channels);
+    for (size_t i = 0; i < frames; ++i)
+    {
+        for (size_t ch = 0; ch < channels; ++ch)
+        {
+            const double t = static_cast<double>(i) / SAMPLE_RATE;
+            const double x = 0.4 * std::sin(2.0 * PI * (200.0 + 300.0 * ch) * t) + 0.2 * std::sin(2.0 * PI * 7000.0 * t);
+            pcm16[i * channels + ch] = static_cast<int16_t>(std::lround(x * 32767.0));
+            pcm24[i * channels + ch] = static_cast<int32_t>(std::lround(x * 8388607.0));
+        }
+    }
+
+    const BiquadCoefficients designs[] = {
+        FilterDesign::lowpass(SAMPLE_RATE, 2000.0, 0.707),
+        FilterDesign::peaking_eq(SAMPLE_RATE, 1000.0, 6.0, 2.0),
+        FilterDesign::highpass(SAMPLE_RATE, 20.0, 0.707), // Poles right next to z = 1
+    };
+
+    for (const auto &coeffs : designs)
+    {
+        const auto [max16, rms16] = fixed_point_error(coeffs, pcm16, channels);
+        EXPECT_LE(max16, 1.0);
+        EXPECT_LT(rms16, 0.35);
+
+        // Q28 coefficients cost a few 24-bit LSBs when the poles sit at 20 Hz
+        const bool deep_bass = &coeffs == &designs[2];
+        const auto [max24, rms24] = fixed_point_error(coeffs, pcm24, channels);
+        EXPECT_LE(max24, deep_bass ? 32.0 : 1.0);
+        EXPECT_LT(rms24, deep_bass ? 8.0 : 0.35);
+    }
+}
+
+TEST_F(FilterTest, FixedPointBiquadSaturatesAndMatchesPerSample)
+{
+    // +12 dB bell on a full-scale tone clips cleanly instead of wrapping
+    FixedPointBiquad<int16_t> boost(FilterDesign::peaking_eq(SAMPLE_RATE, 1000.0, 12.0, 1.0));
+    std::vector<int16_t> tone(4096);
+    for (size_t i = 0; i < tone.size(); ++i)
+    {
+        tone[i] = static_cast<int16_t>(std::lround(30000.0 * std::sin(2.0 * PI * 1000.0 * static_cast<double>(i) / SAMPLE_RATE)));
+    }
+    auto clipped = tone;
+    boost.process_buffer(clipped.data(), clipped.size(), 1);
+    EXPECT_EQ(*std::max_element(clipped.begin(), clipped.end()), 32767);
+    EXPECT_EQ(*std::min_element(clipped.begin(), clipped.end()), -32768);
+
+    // Per-sample path keeps the same state as the lane kernel
+    FixedPointBiquad<int32_t> block(FilterDesign::lowpass(SAMPLE_RATE, 500.0, 0.707));
+    FixedPointBiquad<int32_t> single(block.coefficients());
+    std::vector<int32_t> pcm(2048);
+    for (size_t i = 0; i < pcm.size(); ++i)
+    {
+        pcm[i] = static_cast<int32_t>((i * 2654435761u) % 8000000u) - 4000000;
+    }
+    auto expected = pcm;
+    block.process_buffer(pcm.data(), pcm.size(), 1);
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(single.process_sample(expected[i]), pcm[i]);
+    }
+
+    // Out-of-range 24-bit input is clamped, not wrapped when widened
+    FixedPointBiquad<int32_t> unity;
+    int32_t wide[2] = {std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()};
+    unity.process_buffer(wide, 2, 1);
+    EXPECT_EQ(wide[0], (1 << 23) - 1);
+    EXPECT_EQ(wide[1], -(1 << 23));
+
+    EXPECT_THROW(FixedPointBiquad<int16_t>(BiquadCoefficients{9.0, 0.0, 0.0, 1.0, 0.0, 0.0}), std::invalid_argument);
+}
+
+TEST_F(FilterTest, MultiStreamBiquadMatchesPerStreamCascades)
+{
+    const size_t num_streams = 19; // Two full lane groups and a partial one
+    const size_t frames = 700;     // Crosses tile boundaries
+    MultiStreamBiquad<float> engine(num_streams, 2);
+
+    std::vector<std::vector<float>> audio(num_streams), expected(num_streams);
+    std::vector<float *> pointers(num_streams);
+    for (size_t s = 0; s < num_streams; ++s)
+    {
+        const std::vector<BiquadCoefficients> sections = {
+            FilterDesign::highpass(SAMPLE_RATE, 80.0 + 10.0 * s, 0.707),
+            FilterDesign::peaking_eq(SAMPLE_RATE, 500.0 + 100.0 * s, (s % 2 ? 4.0 : -4.0), 1.0),
+        };
+        ASSERT_EQ(engine.add_stream(sections), s);
+
+        audio[s].resize(frames);
+        for (size_t i = 0; i < frames; ++i)
+        {
+            audio[s][i] = 0.5f * static_cast<float>(std::sin(0.01 * (s + 1) * i) + 0.3 * std::sin(0.4 * i));
+        }
+        expected[s] = audio[s];
+        BiquadCascade<float> reference(sections);
+        reference.process_buffer(expected[s].data(), frames, 1);
+        pointers[s] = audio[s].data();
+    }
+
+    engine.process(pointers, frames);
+    for (size_t s = 0; s < num_streams; ++s)
+    {
+        for (size_t i = 0; i < frames; ++i)
+        {
+            ASSERT_NEAR(audio[s][i], expected[s][i], 1e-5f) << "stream " << s << " sample " << i;
+        }
+    }
+}
+
+TEST_F(FilterTest, MultiStreamBiquadReusesSlots)
+{
+    MultiStreamBiquad<double> engine(4, 1);
+    const BiquadCoefficients lowpass = FilterDesign::lowpass(SAMPLE_RATE, 1000.0, 0.707);
+    const BiquadCoefficients sections[] = {lowpass};
+
+    EXPECT_EQ(engine.capacity(), MultiStreamBiquad<double>::max_lanes);
+    for (size_t i = 0; i < engine.capacity(); ++i)
+    {
+        engine.add_stream(sections);
+    }
+    EXPECT_THROW(engine.add_stream(sections), std::runtime_error);
+
+    engine.remove_stream(2);
+    EXPECT_FALSE(engine.is_active(2));
+    EXPECT_EQ(engine.num_streams(), engine.capacity() - 1);
+
+    // Removed slots are left untouched by process()
+    std::vector<double> a(64, 1.0), b(64, 1.0);
+    std::vector<double *> pointers(engine.capacity(), a.data());
+    pointers[2] = b.data();
+    pointers[3] = nullptr;
+    engine.process(pointers, 1);
+    EXPECT_EQ(b[0], 1.0);
+
+    // A reused slot starts with fresh history and pass-through sections
+    EXPECT_EQ(engine.add_stream(), 2u);
+    engine.process(pointers, b.size());
+    EXPECT_EQ(b, std::vector<double>(64, 1.0));
+
+    engine.set_section(2, 0, lowpass);
+    engine.reset_stream(2);
+    std::vector<double> impulse(32, 0.0);
+    impulse[0] = 1.0;
+    auto reference = impulse;
+    BiquadFilter<double>(lowpass).process_buffer(reference.data(), reference.size(), 1);
+    pointers[2] = impulse.data();
+    engine.process(std::span<double *const>(pointers.data(), 3), impulse.size());
+    for (size_t i = 0; i < impulse.size(); ++i)
+    {
+        EXPECT_NEAR(impulse[i], reference[i], 1e-12);
+    }
+
+    // An active stream without a buffer (null, or past the end) keeps its history
+    BiquadFilter<double> slot3(lowpass);
+    std::vector<double> step(16, 1.0), step_reference(16, 1.0);
+    pointers[3] = step.data();
+    engine.process(std::span<double *const>(pointers.data(), 4), step.size());
+    slot3.process_buffer(step_reference.data(), step_reference.size(), 1);
+    EXPECT_EQ(step, step_reference);
+
+    pointers[3] = nullptr;
+    engine.process(pointers, step.size());
+    engine.process(std::span<double *const>(pointers.data(), 3), step.size());
+
+    std::fill(step.begin(), step.end(), 1.0);
+    std::fill(step_reference.begin(), step_reference.end(), 1.0);
+    pointers[3] = step.data();
+    engine.process(std::span<double *const>(pointers.data(), 4), step.size());
+    slot3.process_buffer(step_reference.data(), step_reference.size(), 1);
+    for (size_t i = 0; i < step.size(); ++i)
+    {
+        EXPECT_NEAR(step[i], step_reference[i], 1e-12);
+    }
+
+    EXPECT_THROW(engine.set_section(2, 1, lowpass), std::out_of_range);
+}
+
+TEST_F(FilterTest, LinearPhaseEqualizerMatchesBandMagnitude)
+{
+    Equalizer<float> eq(SAMPLE_RATE);
+    eq.add_band(200.0, -4.0, 1.0);
+    eq.add_band(1000.0, 6.0, 1.0);
+    eq.add_band(8000.0, 3.0, 2.0);
+    const double tones[] = {200.0, 1000.0, 3000.0, 8000.0};
+    const auto expected = eq.frequency_response(tones);
+
+    eq.set_linear_phase(true);
+    EXPECT_TRUE(eq.is_linear_phase());
+    EXPECT_EQ(eq.latency(), (Equalizer<float>::default_linear_phase_taps - 1) / 2);
+
+    for (size_t t = 0; t < std::size(tones); ++t)
+    {
+        eq.reset();
+        auto buffer = generate_sine(tones[t], 0.5, 1);
+        eq.process(buffer);
+        const double gain = tone_amplitude(buffer, tones[t], 8192, 8192);
+        EXPECT_NEAR(20.0 * std::log10(gain), expected.magnitude_db(t), 0.3) << tones[t] << " Hz";
+    }
+
+    // Impulse response is symmetric about the latency
+    eq.reset();
+    AudioBuffer<float> impulse(eq.latency() * 2 + 1, 1);
+    impulse.data()[0] = 1.0f;
+    eq.process(impulse);
+    for (size_t i = 1; i <= eq.latency(); ++i)
+    {
+        ASSERT_NEAR(impulse.data()[eq.latency() - i], impulse.data()[eq.latency() + i], 1e-6f);
+    }
+}
+
+TEST_F(FilterTest, LinearPhaseEqualizerReportsDesignedKernel)
+{
+    // Narrow low bands the default kernel cannot fully resolve
+    Equalizer<float> eq(SAMPLE_RATE);
+    eq.create_10band_eq();
+    eq.set_band_gain(0, 12.0);
+    eq.set_band_gain(1, -12.0);
+    const double tones[] = {31.25, 62.5, 1000.0, 8000.0};
+    const auto cascade = eq.frequency_response(tones);
+
+    eq.set_linear_phase(true);
+    EXPECT_GT(eq.linear_phase_resolution(), 20.0);
+    const auto reported = eq.frequency_response(tones);
+
+    // Measured: DFT of the impulse response the EQ actually applies
+    AudioBuffer<float> impulse(2 * eq.latency() + 1, 1);
+    impulse.data()[0] = 1.0f;
+    eq.process(impulse);
+    for (size_t t = 0; t < std::size(tones); ++t)
+    {
+        std::complex<double> h = 0.0;
+        for (size_t n = 0; n < impulse.num_samples(); ++n)
+        {
+            h += static_cast<double>(impulse.data()[n]) * std::polar(1.0, -TWO_PI * tones[t] * static_cast<double>(n) / SAMPLE_RATE);
+        }
+        EXPECT_NEAR(reported.magnitude_db(t), 20.0 * std::log10(std::abs(h)), 0.05) << tones[t] << " Hz";
+    }
+
+    // The kernel is shallower than the cascade in the low bands, and the report says so
+    EXPECT_LT(reported.magnitude_db(0), cascade.magnitude_db(0) - 1.0);
+    EXPECT_GT(reported.magnitude_db(1), cascade.magnitude_db(1) + 1.0);
+    EXPECT_NEAR(reported.magnitude_db(2), cascade.magnitude_db(2), 0.3);
+
+    // A longer kernel resolves them
+    eq.set_linear_phase(true, 4 * Equalizer<float>::default_linear_phase_taps + 1);
+    const auto longer = eq.frequency_response(tones);
+    EXPECT_NEAR(longer.magnitude_db(0), cascade.magnitude_db(0), 0.5);
+    EXPECT_NEAR(longer.magnitude_db(1), cascade.magnitude_db(1), 0.5);
+}
+
+TEST_F(FilterTest, LinearPhaseEqualizerRebuildsInBackground)
+{
+    Equalizer<float> eq(SAMPLE_RATE);
+    const size_t band = eq.add_band(1000.0, 0.0, 1.0);
+    eq.set_linear_phase(true, 1023);
+
+    // Flat EQ: a delayed copy of the input
+    auto buffer = generate_sine(1000.0, 0.2, 2);
+    const auto original = buffer;
+    eq.process(buffer);
+    for (size_t i = eq.latency(); i < buffer.num_samples(); ++i)
+    {
+        ASSERT_NEAR(buffer(i, 1), original(i - eq.latency(), 1), 1e-4f);
+    }
+
+    // Boost while streaming; the new kernel fades in without a step
+    const size_t block = 512;
+    AudioBuffer<float> stream(block * 40, 1);
+    for (size_t i = 0; i < stream.num_samples(); ++i)
+    {
+        stream.data()[i] = static_cast<float>(0.25 * std::sin(TWO_PI * 1000.0 * static_cast<double>(i) / SAMPLE_RATE));
+    }
+    eq.reset();
+    for (size_t start = 0; start < stream.num_samples(); start += block)
+    {
+        if (start == block * 20)
+        {
+            eq.set_band_gain(band, 6.0);
+            eq.wait_for_kernel();
+        }
+
+        AudioBuffer<float> chunk(block, 1);
+        std::copy(stream.data() + start, stream.data() + start + block, chunk.data());
+        eq.process(chunk);
+        std::copy(chunk.data(), chunk.data() + block, stream.data() + start);
+    }
+
+    float max_step = 0.0f;
+    for (size_t i = 1; i < stream.num_samples(); ++i)
+    {
+        max_step = std::max(max_step, std::abs(stream.data()[i] - stream.data()[i - 1]));
+    }
+    const double slope = 0.5 * TWO_PI * 1000.0 / SAMPLE_RATE; // Steepest step of a +6 dB tone
+    EXPECT_LT(max_step, slope * 1.05);
+    EXPECT_NEAR(tone_amplitude(stream, 1000.0, 2048, 8192), 0.25, 0.005);
+    EXPECT_NEAR(tone_amplitude(stream, 1000.0, 11264, 8192), 0.5, 0.01);
+
+    // Movable; the moved-to EQ keeps its kernel and history
+    static_assert(std::is_move_constructible_v<Equalizer<float>>);
+    Equalizer<float> moved = std::move(eq);
+    AudioBuffer<float> more(block, 1);
+    for (size_t i = 0; i < block; ++i)
+    {
+        more.data()[i] = static_cast<float>(0.25 * std::sin(TWO_PI * 1000.0 * static_cast<double>(stream.num_samples() + i) / SAMPLE_RATE));
+    }
+    moved.process(more);
+    float peak = 0.0f;
+    for (size_t i = 0; i < block; ++i)
+    {
+        peak = std::max(peak, std::abs(more.data()[i]));
+    }
+    EXPECT_NEAR(peak, 0.5f, 0.01f); // Still the boosted tone, no restart transient
+
+    moved.set_linear_phase(false);
+    EXPECT_EQ(moved.latency(), 0u);
+    EXPECT_THROW(moved.set_linear_phase(true, 1024), std::invalid_argument);
+}
+
+TEST_F(FilterTest, LinearPhaseEqualizerSwapsPrimedKernelWhileStreaming)
+{
+    // References run the flat and the boosted kernel from the start
+    Equalizer<float> flat(SAMPLE_RATE), boosted(SAMPLE_RATE);
+    flat.add_band(1000.0, 0.0, 1.0);
+    boosted.add_band(1000.0, 6.0, 1.0);
+
+    // Offline, wait_for_kernel() primes up to the current frame, so the swap lands on the next block.
+    // Streaming, the worker primes from the history the audio thread offers.
+    // Either way every block comes from the old kernel or the new one, except one crossfade block.
+    const size_t block = 256;
+    for (bool offline : {true, false})
+    {
+        Equalizer<float> eq(SAMPLE_RATE);
+        const size_t band = eq.add_band(1000.0, 0.0, 1.0);
+        for (auto *e : {&eq, &flat, &boosted})
+        {
+            e->set_linear_phase(true, 1023);
+            e->prepare(1);
+        }
+
+        AudioBuffer<float> a(block, 1), b(block, 1), c(block, 1);
+        size_t n = 0, fading_blocks = 0;
+        bool swapped = false;
+        for (size_t k = 0; k < 400; ++k)
+        {
+            if (k == 10)
+            {
+                eq.set_band_gain(band, 6.0);
+                if (offline)
+                {
+                    eq.wait_for_kernel();
+                }
+            }
+            for (size_t i = 0; i < block; ++i, ++n)
+            {
+                a.data()[i] = b.data()[i] = c.data()[i] =
+                    static_cast<float>(0.25 * std::sin(TWO_PI * 700.0 * static_cast<double>(n) / SAMPLE_RATE));
+            }
+            eq.process(a);
+            flat.process(b);
+            boosted.process(c);
+            if (!offline)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+
+            float from_old = 0.0f, from_new = 0.0f;
+            for (size_t i = 0; i < block; ++i)
+            {
+                from_old = std::max(from_old, std::abs(a.data()[i] - b.data()[i]));
+                from_new = std::max(from_new, std::abs(a.data()[i] - c.data()[i]));
+            }
+            if (from_old < 1e-5f && from_new < 1e-5f)
+            {
+                continue; // Still inside the kernel's latency: both references are silent
+            }
+            if (from_new < 1e-5f)
+            {
+                swapped = true;
+                continue;
+            }
+            ASSERT_FALSE(swapped) << "block " << k << (offline ? " offline" : " streaming");
+            fading_blocks += from_old < 1e-5f ? 0 : 1;
+        }
+        EXPECT_TRUE(swapped);
+        EXPECT_EQ(fading_blocks, 1u) << (offline ? "offline" : "streaming");
+
+        if (offline)
+        {
+            continue;
+        }
+
+        // Reported phase is the kernel's pure delay
+        const double tones[] = {100.0, 700.0, 5000.0};
+        const auto response = eq.frequency_response(tones);
+        for (size_t t = 0; t < std::size(tones); ++t)
+        {
+            const double expected = -TWO_PI * tones[t] / SAMPLE_RATE * static_cast<double>(eq.latency());
+            EXPECT_NEAR(std::remainder(response.phase[t] - expected, TWO_PI), 0.0, 1e-9) << tones[t] << " Hz";
+        }
+
+        // Destroyed with a design in flight: the worker is joined
+        eq.set_band_gain(band, -3.0);
+    }
+}
+
+TEST_F(FilterTest, LinearPhaseBuilderReleasesPoolWithoutSnapshot)
+{
+    ThreadPool pool(2);
+    LinearPhaseBuilder<float> builder(pool, std::chrono::milliseconds(5));
+    LinearPhaseBuilder<float>::Spec spec;
+    spec.sections = {FilterDesign::peaking_eq(SAMPLE_RATE, 1000.0, 6.0, 1.0)};
+    spec.sample_rate = SAMPLE_RATE;
+    spec.num_taps = 255;
+    spec.num_channels = 1;
+
+    // Nobody processes: the task publishes the kernel unprimed and goes idle
+    auto wait_idle = [&]
+    {
+        for (int i = 0; i < 10000 && builder.busy(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return !builder.busy();
+    };
+    builder.request(spec);
+    ASSERT_TRUE(wait_idle());
+    uint64_t primed = 1;
+    auto kernel = builder.exchange(primed);
+    ASSERT_NE(kernel, nullptr);
+    EXPECT_EQ(primed, 0u);
+
+    // An offline snapshot primes the next one
+    std::vector<float> history(spec.num_taps - 1, 0.25f);
+    spec.sections[0] = FilterDesign::peaking_eq(SAMPLE_RATE, 1000.0, -6.0, 1.0);
+    builder.request(spec);
+    builder.wait(history, 1000);
+    kernel = builder.exchange(primed);
+    ASSERT_NE(kernel, nullptr);
+    EXPECT_EQ(primed, 1000u);
+    EXPECT_TRUE(wait_idle());
+    EXPECT_EQ(builder.exchange(primed), nullptr);
+}
+
+TEST_F(FilterTest, LinearPhaseEqualizerResumesAfterIdleEdit)
+{
+    Equalizer<float> eq(SAMPLE_RATE);
+    const size_t band = eq.add_band(1000.0, 0.0, 1.0);
+    eq.set_linear_phase(true, 1023);
+    eq.prepare(1);
+    AudioBuffer<float> buffer(256, 1);
+    eq.process(buffer);
+
+    // Edit with processing stopped; resuming delivers the new kernel
+    eq.set_band_gain(band, 6.0);
+    eq.wait_for_kernel();
+    auto tone = generate_sine(1000.0, 0.5, 1);
+    eq.process(tone);
+    EXPECT_NEAR(tone_amplitude(tone, 1000.0, 8192, 8192), std::pow(10.0, 6.0 / 20.0), 0.02);
+
+    // Disabling with a design pending leaves nothing to do
+    eq.set_band_gain(band, -6.0);
+    eq.set_linear_phase(false);
+    EXPECT_FALSE(eq.is_linear_phase());
+}
+
+TEST_F(FilterTest, LinkwitzRileyAllpassMatchesSummedPair)
+{
+    const double freqs[] = {50.0, 700.0, 1000.0, 3000.0};
+    for (int order : {2, 4, 6, 8})
+    {
+        const auto lowpass = CascadeDesign::linkwitz_riley_lowpass(SAMPLE_RATE, 1000.0, order);
+        const auto highpass = CascadeDesign::linkwitz_riley_highpass(SAMPLE_RATE, 1000.0, order);
+        const auto allpass = CascadeDesign::linkwitz_riley_allpass(SAMPLE_RATE, 1000.0, order);
+        const double sign = (order / 2) % 2 == 1 ? -1.0 : 1.0;
+
+        for (double f : freqs)
+        {
+            const auto summed = cascade_response(lowpass, f) + sign * cascade_response(highpass, f);
+            const auto expected = cascade_response(allpass, f);
+            EXPECT_NEAR(std::abs(expected), 1.0, 1e-9);
+            EXPECT_NEAR(std::abs(summed - expected), 0.0, 1e-9) << "LR" << order << " at " << f << " Hz";
+        }
+    }
+}
+
+TEST_F(FilterTest, CrossoverSumIsAllpass)
+{
+    const std::vector<double> points = {150.0, 800.0, 2500.0, 7000.0};
+    for (int order : {2, 4, 8})
+    {
+        Crossover<float> crossover(SAMPLE_RATE, points, order);
+        EXPECT_EQ(crossover.num_bands(), 5u);
+
+        // Untouched bands add back to the allpasses of every point
+        std::vector<BiquadCoefficients> allpasses;
+        for (double f : points)
+        {
+            const auto sections = CascadeDesign::linkwitz_riley_allpass(SAMPLE_RATE, f, order);
+            allpasses.insert(allpasses.end(), sections.begin(), sections.end());
+        }
+        BiquadCascade<float> reference(allpasses);
+
+        auto buffer = generate_sine(440.0, 0.05, 2);
+        for (size_t i = 0; i < buffer.total_samples(); ++i)
+        {
+            buffer.data()[i] += 0.3f * static_cast<float>(std::sin(0.9 * static_cast<double>(i)));
+        }
+        auto expected = buffer;
+        reference.process_buffer(expected.data(), expected.num_samples(), 2);
+        crossover.process(buffer);
+
+        for (size_t i = 0; i < buffer.total_samples(); ++i)
+        {
+            ASSERT_NEAR(buffer.data()[i], expected.data()[i], 2e-4f) << "LR" << order << " sample " << i;
+        }
+    }
+}
+
+TEST_F(FilterTest, CrossoverBandChainsProcessOwnBand)
+{
+    ThreadPool pool(3);
+    Crossover<float> crossover(SAMPLE_RATE, {200.0, 2000.0}, 4, &pool);
+
+    // Mute the mid band, boost the highs
+    crossover.emplace_effect<GainEffect<float>>(1, 0.0f);
+    auto &boost = crossover.emplace_effect<GainEffect<float>>(2, 2.0f);
+    EXPECT_EQ(crossover.num_effects(1), 1u);
+
+    AudioBuffer<float> buffer(8192, 1);
+    for (size_t i = 0; i < buffer.num_samples(); ++i)
+    {
+        const double t = static_cast<double>(i) / SAMPLE_RATE;
+        buffer.data()[i] = static_cast<float>(0.2 * (std::sin(TWO_PI * 60.0 * t) + std::sin(TWO_PI * 630.0 * t) +
+                                                     std::sin(TWO_PI * 9000.0 * t)));
+    }
+    crossover.process(buffer);
+
+    EXPECT_NEAR(tone_amplitude(buffer, 60.0, 4096, 4096), 0.2, 0.01);
+    EXPECT_LT(tone_amplitude(buffer, 630.0, 4096, 4096), 0.2 * 0.05);
+    EXPECT_NEAR(tone_amplitude(buffer, 9000.0, 4096, 4096), 0.4, 0.01);
+    EXPECT_NEAR(tone_amplitude(crossover.band_output(0), 60.0, 4096, 4096), 0.2, 0.01);
+
+    // Disabled effects are skipped
+    boost.set_enabled(false);
+    crossover.clear_effects(1);
+    crossover.reset();
+    crossover.process(buffer);
+
+    EXPECT_THROW(Crossover<float>(SAMPLE_RATE, {2000.0, 200.0}), std::invalid_argument);
+    EXPECT_THROW(Crossover<float>(SAMPLE_RATE, {100.0, 200.0, 400.0, 800.0, 1600.0, 3200.0}), std::invalid_argument);
+    EXPECT_THROW(Crossover<float>(SAMPLE_RATE, {1000.0}, 3), std::invalid_argument);
+    EXPECT_THROW(crossover.set_frequency(0, 5000.0), std::invalid_argument);
+    EXPECT_DOUBLE_EQ(crossover.frequencies()[0], 200.0);
+}
+
+TEST_F(FilterTest, NestedCrossoversShareOnePool)
+{
+    // The inner split runs inside an outer band job and must not wait on the pool
+    auto build = [](ThreadPool *pool)
+    {
+        auto outer = std::make_unique<Crossover<float>>(SAMPLE_RATE, std::vector<double>{300.0, 3000.0}, 4, pool);
+        for (size_t band = 0; band < outer->num_bands(); ++band)
+        {
+            auto &inner = outer->emplace_effect<Crossover<float>>(band, SAMPLE_RATE, std::vector<double>{150.0 * (band + 1)}, 4, pool);
+            inner.emplace_effect<GainEffect<float>>(1, 0.5f);
+        }
+        return outer;
+    };
+
+    ThreadPool pool(3);
+    auto parallel = build(&pool);
+    auto sequential = build(nullptr);
+
+    auto a = generate_sine(440.0, 0.1, 2);
+    auto b = a;
+    for (int block = 0; block < 4; ++block)
+    {
+        parallel->process(a);
+        sequential->process(b);
+    }
+    EXPECT_FALSE(ThreadPool::in_job());
+    for (size_t i = 0; i < a.total_samples(); ++i)
+    {
+        ASSERT_EQ(a.data()[i], b.data()[i]);
+    }
+}